@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+from scapy.all import *
+
+
+def write_pcap(filename, *packetsList):
+	PcapWriter(filename)
+	for packets in packetsList:
+		if type(packets) == list:
+			for packet in packets:
+				packet.time = 0
+				wrpcap(filename, [p for p in packet], append=True)
+		else:
+			packets.time = 0
+			wrpcap(filename, [p for p in packets], append=True)
+
+
+# check IPv6 -> IPv4, 1:1 translations resolved by lookup
+write_pcap("001-send.pcap",
+           Ether(dst="00:11:22:33:44:55", src="00:00:00:00:00:01")/Dot1Q(vlan=100)/IPv6(dst="2222:111::11.11.11.0", src="2000::a", hlim=64)/TCP(dport=80, sport=2048),
+           Ether(dst="00:11:22:33:44:55", src="00:00:00:00:00:01")/Dot1Q(vlan=100)/IPv6(dst="2222:111::11.11.11.0", src="2000::b", hlim=64)/TCP(dport=80, sport=2048),
+           Ether(dst="00:11:22:33:44:55", src="00:00:00:00:00:01")/Dot1Q(vlan=100)/IPv6(dst="2222:222::11.11.11.0", src="2000::a", hlim=64)/TCP(dport=80, sport=2048))
+
+write_pcap("001-expect.pcap",
+           Ether(dst="00:00:00:22:22:22", src="00:11:22:33:44:55")/Dot1Q(vlan=200)/IP(dst="11.11.11.0", src="10.1.0.1", ttl=63, id=0)/TCP(dport=80, sport=2048),
+           Ether(dst="00:00:00:22:22:22", src="00:11:22:33:44:55")/Dot1Q(vlan=200)/IP(dst="11.11.11.0", src="10.1.0.2", ttl=63, id=0)/TCP(dport=80, sport=2048),
+           Ether(dst="00:00:00:22:22:22", src="00:11:22:33:44:55")/Dot1Q(vlan=200)/IP(dst="11.11.11.0", src="10.1.0.3", ttl=63, id=0)/TCP(dport=80, sport=2048))
+
+
+# check IPv4 -> IPv6, 1:1 translations resolved by lookup
+write_pcap("002-send.pcap",
+           Ether(dst="00:11:22:33:44:55", src="00:00:00:00:00:02")/Dot1Q(vlan=200)/IP(dst="10.1.0.1", src="11.11.11.0", ttl=64)/TCP(dport=2048, sport=80),
+           Ether(dst="00:11:22:33:44:55", src="00:00:00:00:00:02")/Dot1Q(vlan=200)/IP(dst="10.1.0.2", src="11.11.11.0", ttl=64)/TCP(dport=2048, sport=80),
+           Ether(dst="00:11:22:33:44:55", src="00:00:00:00:00:02")/Dot1Q(vlan=200)/IP(dst="10.1.0.3", src="11.11.11.0", ttl=64)/TCP(dport=2048, sport=80))
+
+write_pcap("002-expect.pcap",
+           Ether(dst="00:00:00:11:11:11", src="00:11:22:33:44:55")/Dot1Q(vlan=100)/IPv6(dst="2000::a", src="2222:111::11.11.11.0", hlim=63, fl=0)/TCP(dport=2048, sport=80),
+           Ether(dst="00:00:00:11:11:11", src="00:11:22:33:44:55")/Dot1Q(vlan=100)/IPv6(dst="2000::b", src="2222:111::11.11.11.0", hlim=63, fl=0)/TCP(dport=2048, sport=80),
+           Ether(dst="00:00:00:11:11:11", src="00:11:22:33:44:55")/Dot1Q(vlan=100)/IPv6(dst="2000::a", src="2222:222::11.11.11.0", hlim=63, fl=0)/TCP(dport=2048, sport=80))
+
+
+# check IPv6 -> IPv4, 1:1 translations share ipv4 address
+write_pcap("003-send.pcap",
+           Ether(dst="00:11:22:33:44:55", src="00:00:00:00:00:01")/Dot1Q(vlan=100)/IPv6(dst="2222:111::11.11.11.0", src="2000::c", hlim=64)/TCP(dport=80, sport=2048),
+           Ether(dst="00:11:22:33:44:55", src="00:00:00:00:00:01")/Dot1Q(vlan=100)/IPv6(dst="2222:111::11.11.11.0", src="2000::d", hlim=64)/TCP(dport=80, sport=2048))
+
+write_pcap("003-expect.pcap",
+           Ether(dst="00:00:00:22:22:22", src="00:11:22:33:44:55")/Dot1Q(vlan=200)/IP(dst="11.11.11.0", src="10.2.0.1", ttl=63, id=0)/TCP(dport=80, sport=2048),
+           Ether(dst="00:00:00:22:22:22", src="00:11:22:33:44:55")/Dot1Q(vlan=200)/IP(dst="11.11.11.0", src="10.2.0.1", ttl=63, id=0)/TCP(dport=80, sport=2048))
+
+
+# check IPv4 -> IPv6, shared ipv4 address is resolved to first translation
+write_pcap("004-send.pcap",
+           Ether(dst="00:11:22:33:44:55", src="00:00:00:00:00:02")/Dot1Q(vlan=200)/IP(dst="10.2.0.1", src="11.11.11.0", ttl=64)/TCP(dport=2048, sport=80),
+           Ether(dst="00:11:22:33:44:55", src="00:00:00:00:00:02")/Dot1Q(vlan=200)/IP(dst="10.2.0.1", src="11.11.11.0", ttl=64)/TCP(dport=2049, sport=80))
+
+write_pcap("004-expect.pcap",
+           Ether(dst="00:00:00:11:11:11", src="00:11:22:33:44:55")/Dot1Q(vlan=100)/IPv6(dst="2000::c", src="2222:111::11.11.11.0", hlim=63, fl=0)/TCP(dport=2048, sport=80),
+           Ether(dst="00:00:00:11:11:11", src="00:11:22:33:44:55")/Dot1Q(vlan=100)/IPv6(dst="2000::c", src="2222:111::11.11.11.0", hlim=63, fl=0)/TCP(dport=2049, sport=80))
+
+
+# check IPv6 -> IPv4, 1:1 translation overlaps port range translation, first one matches
+write_pcap("005-send.pcap",
+           Ether(dst="00:11:22:33:44:55", src="00:00:00:00:00:01")/Dot1Q(vlan=100)/IPv6(dst="2222:333::11.11.11.0", src="2000::e", hlim=64)/TCP(dport=80, sport=2002),
+           Ether(dst="00:11:22:33:44:55", src="00:00:00:00:00:01")/Dot1Q(vlan=100)/IPv6(dst="2222:333::11.11.11.0", src="2000::e", hlim=64)/TCP(dport=80, sport=2048),
+           Ether(dst="00:11:22:33:44:55", src="00:00:00:00:00:01")/Dot1Q(vlan=100)/IPv6(dst="2222:444::11.11.11.0", src="2000::f", hlim=64)/TCP(dport=80, sport=2002),
+           Ether(dst="00:11:22:33:44:55", src="00:00:00:00:00:01")/Dot1Q(vlan=100)/IPv6(dst="2222:444::11.11.11.0", src="2000::f", hlim=64)/TCP(dport=80, sport=2048))
+
+write_pcap("005-expect.pcap",
+           Ether(dst="00:00:00:22:22:22", src="00:11:22:33:44:55")/Dot1Q(vlan=200)/IP(dst="11.11.11.0", src="10.3.0.2", ttl=63, id=0)/TCP(dport=80, sport=2002),
+           Ether(dst="00:00:00:22:22:22", src="00:11:22:33:44:55")/Dot1Q(vlan=200)/IP(dst="11.11.11.0", src="10.3.0.2", ttl=63, id=0)/TCP(dport=80, sport=2048),
+           Ether(dst="00:00:00:22:22:22", src="00:11:22:33:44:55")/Dot1Q(vlan=200)/IP(dst="11.11.11.0", src="10.3.0.1", ttl=63, id=0)/TCP(dport=80, sport=2002),
+           Ether(dst="00:00:00:22:22:22", src="00:11:22:33:44:55")/Dot1Q(vlan=200)/IP(dst="11.11.11.0", src="10.3.0.1", ttl=63, id=0)/TCP(dport=80, sport=2048))
+
+
+# check IPv4 -> IPv6, 1:1 translation overlaps port range translation, first one matches
+write_pcap("006-send.pcap",
+           Ether(dst="00:11:22:33:44:55", src="00:00:00:00:00:02")/Dot1Q(vlan=200)/IP(dst="10.3.0.1", src="11.11.11.0", ttl=64)/TCP(dport=12002, sport=80),
+           Ether(dst="00:11:22:33:44:55", src="00:00:00:00:00:02")/Dot1Q(vlan=200)/IP(dst="10.3.0.1", src="11.11.11.0", ttl=64)/TCP(dport=2048, sport=80),
+           Ether(dst="00:11:22:33:44:55", src="00:00:00:00:00:02")/Dot1Q(vlan=200)/IP(dst="10.3.0.2", src="11.11.11.0", ttl=64)/TCP(dport=12002, sport=80),
+           Ether(dst="00:11:22:33:44:55", src="00:00:00:00:00:02")/Dot1Q(vlan=200)/IP(dst="10.3.0.2", src="11.11.11.0", ttl=64)/TCP(dport=2048, sport=80))
+
+write_pcap("006-expect.pcap",
+           Ether(dst="00:00:00:11:11:11", src="00:11:22:33:44:55")/Dot1Q(vlan=100)/IPv6(dst="2000::e", src="2222:333::11.11.11.0", hlim=63, fl=0)/TCP(dport=2002, sport=80),
+           Ether(dst="00:00:00:11:11:11", src="00:11:22:33:44:55")/Dot1Q(vlan=100)/IPv6(dst="2000::f", src="2222:444::11.11.11.0", hlim=63, fl=0)/TCP(dport=2048, sport=80),
+           Ether(dst="00:00:00:11:11:11", src="00:11:22:33:44:55")/Dot1Q(vlan=100)/IPv6(dst="2000::e", src="2222:333::11.11.11.0", hlim=63, fl=0)/TCP(dport=12002, sport=80),
+           Ether(dst="00:00:00:11:11:11", src="00:11:22:33:44:55")/Dot1Q(vlan=100)/IPv6(dst="2000::e", src="2222:333::11.11.11.0", hlim=63, fl=0)/TCP(dport=2048, sport=80))
+
+
+# check IPv6 -> IPv4, lookup miss is dropped
+write_pcap("007-send.pcap",
+           Ether(dst="00:11:22:33:44:55", src="00:00:00:00:00:01")/Dot1Q(vlan=100)/IPv6(dst="2222:111::11.11.11.0", src="2000::99", hlim=64)/TCP(dport=80, sport=2048),
+           Ether(dst="00:11:22:33:44:55", src="00:00:00:00:00:01")/Dot1Q(vlan=100)/IPv6(dst="2222:222::11.11.11.0", src="2000::b", hlim=64)/TCP(dport=80, sport=2048),
+           Ether(dst="00:11:22:33:44:55", src="00:00:00:00:00:01")/Dot1Q(vlan=100)/IPv6(dst="2222:555::11.11.11.0", src="2000::a", hlim=64)/TCP(dport=80, sport=2048))
+
+write_pcap("007-expect.pcap")
+
+
+# check IPv4 -> IPv6, lookup miss is dropped
+write_pcap("008-send.pcap",
+           Ether(dst="00:11:22:33:44:55", src="00:00:00:00:00:02")/Dot1Q(vlan=200)/IP(dst="10.1.0.4", src="11.11.11.0", ttl=64)/TCP(dport=2048, sport=80),
+           Ether(dst="00:11:22:33:44:55", src="00:00:00:00:00:02")/Dot1Q(vlan=200)/IP(dst="10.2.0.2", src="11.11.11.0", ttl=64)/TCP(dport=2048, sport=80),
+           Ether(dst="00:11:22:33:44:55", src="00:00:00:00:00:02")/Dot1Q(vlan=200)/IP(dst="10.3.0.3", src="11.11.11.0", ttl=64)/TCP(dport=2048, sport=80))
+
+write_pcap("008-expect.pcap")
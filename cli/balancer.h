@@ -373,7 +373,7 @@ void state(std::string module,
 		}
 	}
 
-	TablePrinter table;
+	TablePrinter table({}, TablePrinter::stream_sample_rows);
 	table.insert_row("module",
 	                 "virtual_ip",
 	                 "proto",
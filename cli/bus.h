@@ -60,7 +60,10 @@ inline std::vector<bus_request_info> get_bus_requests(common::sdp::DataPlaneInSh
 	        {common::idp::requestType::neighbor_update_interfaces, "neighbor_update_interfaces"},
 	        {common::idp::requestType::neighbor_stats, "neighbor_stats"},
 	        {common::idp::requestType::memory_manager_update, "memory_manager_update"},
-	        {common::idp::requestType::memory_manager_stats, "memory_manager_stats"}};
+	        {common::idp::requestType::memory_manager_stats, "memory_manager_stats"},
+	        {common::idp::requestType::get_fw_state_page, "get_fw_state_page"},
+	        {common::idp::requestType::state_export, "state_export"},
+	        {common::idp::requestType::state_import, "state_import"}};
 
 	std::vector<bus_request_info> result;
 	for (uint32_t index = 0; index < (uint32_t)common::idp::requestType::size; ++index)
@@ -20,6 +20,7 @@
 #include "rib.h"
 #include "route.h"
 #include "show.h"
+#include "state.h"
 #include "telegraf.h"
 
 std::string binPath;
@@ -82,6 +83,7 @@ std::vector<std::tuple<std::string,
                     {"route counters", "", [](const auto& args) { Call(route::counters, args); }},
                     {"route tunnel counters", "", [](const auto& args) { Call(route::tunnel::counters, args); }},
                     {"neighbor show", "", [](const auto& args) { Call(neighbor::show, args); }},
+                    {"neighbor show shm", "", [](const auto& args) { Call(neighbor::show_shm, args); }},
                     {"neighbor insert", "[route_name] [interface_name] [ip_address] [mac_address]", [](const auto& args) { Call(neighbor::insert, args); }},
                     {"neighbor remove", "[route_name] [interface_name] [ip_address]", [](const auto& args) { Call(neighbor::remove, args); }},
                     {"neighbor flush", "", [](const auto& args) { Call(neighbor::flush, args); }},
@@ -101,9 +103,11 @@ std::vector<std::tuple<std::string,
                     {"dump", "[in|out|drop] [interface_name] [enable|disable]", [](const auto& args) { Call(show::physical_port_dump, args); }},
                     {},
                     {"show errors", "", [](const auto& args) { Call(show::errors, args); }},
+                    {"show report", "", [](const auto& args) { Call(show::report, args); }},
                     {},
                     {"fw show", "<original|generated|state|all|dispatcher>", [](const auto& args) { Call(show::fw, args); }},
                     {"fw list", "<original|generated|state|all|dispatcher>", [](const auto& args) { Call(show::fwlist, args); }},
+                    {"fw states", "[proto] [src_prefix] [dst_prefix] [src_port] [dst_port]", [](const auto& args) { Call(show::fw_states, args); }},
                     {},
                     {"show shm info", "", [](const auto& args) { Call(show::shm_info, args); }},
                     {},
@@ -135,6 +139,7 @@ std::vector<std::tuple<std::string,
                     {"telegraf balancer service", "", [](const auto& args) { Call(telegraf::balancer::service, args); }},
                     {"telegraf other", "", [](const auto& args) { Call(telegraf::other, args); }},
                     {"telegraf tun64", "", [](const auto& args) { Call(telegraf::mappings, args); }},
+                    {"telegraf tun64 delta", "[cursor_file]", [](const auto& args) { Call(telegraf::mappings_delta, args); }},
                     {"telegraf counters", "", [](const auto& args) { Call(telegraf::main_counters, args); }},
                     {"telegraf bus", "", [](const auto& args) { Call(bus::bus_telegraf, args); }},
                     {"telegraf route", "", [](const auto& args) { Call(telegraf::route, args); }},
@@ -150,6 +155,9 @@ std::vector<std::tuple<std::string,
                     {"bus requests", "", [](const auto& args) { Call(bus::bus_requests, args); }},
                     {"bus errors", "", [](const auto& args) { Call(bus::bus_errors, args); }},
 
+                    {"state export", "[path]", [](const auto& args) { Call(state::export_file, args); }},
+                    {"state import", "[path]", [](const auto& args) { Call(state::import_file, args); }},
+
                     {"latch update dataplane", "<latch name> <state>", [](const auto& args) { Call(latch::dataplane_update, args); }},
                     {},
                     {"convert logical_module", "", [](const auto& args) { Call(convert::logical_module, args); }}};
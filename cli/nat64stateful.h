@@ -140,10 +140,11 @@ void state(std::optional<std::string> module)
 		modules[nat64stateful.nat64stateful_id] = module;
 	}
 
+	constexpr uint32_t page_limit = 4096;
+
 	interface::dataPlane dataplane;
-	const auto response = dataplane.nat64stateful_state({module_id});
 
-	TablePrinter table;
+	TablePrinter table({}, TablePrinter::stream_sample_rows);
 	table.insert_row("module",
 	                 "ipv6_source",
 	                 "ipv4_source",
@@ -157,38 +158,44 @@ void state(std::optional<std::string> module)
 	                 "lan_last_seen",
 	                 "wan_last_seen");
 
-	for (const auto& [nat64stateful_id,
-	                  proto,
-	                  ipv6_source,
-	                  ipv6_destination,
-	                  port_source,
-	                  port_destination,
-	                  ipv4_source,
-	                  wan_port_source,
-	                  lan_flags,
-	                  wan_flags,
-	                  lan_last_seen,
-	                  wan_last_seen] : response)
+	std::optional<common::idp::nat64stateful_state::cursor> cursor;
+	do
 	{
-		auto it = modules.find(nat64stateful_id);
-		if (it == modules.end())
+		const auto [states, next_cursor] = dataplane.nat64stateful_state({module_id, cursor, page_limit});
+		for (const auto& [nat64stateful_id,
+		                  proto,
+		                  ipv6_source,
+		                  ipv6_destination,
+		                  port_source,
+		                  port_destination,
+		                  ipv4_source,
+		                  wan_port_source,
+		                  lan_flags,
+		                  wan_flags,
+		                  lan_last_seen,
+		                  wan_last_seen] : states)
 		{
-			it = modules.emplace_hint(it, nat64stateful_id, "unknown");
+			auto it = modules.find(nat64stateful_id);
+			if (it == modules.end())
+			{
+				it = modules.emplace_hint(it, nat64stateful_id, "unknown");
+			}
+
+			table.insert_row(it->second,
+			                 ipv6_source,
+			                 ipv4_source,
+			                 ipv6_destination.get_mapped_ipv4_address().toString().data(),
+			                 proto_to_string(proto).data(),
+			                 port_source,
+			                 wan_port_source,
+			                 port_destination,
+			                 tcp_flags_to_string(lan_flags),
+			                 tcp_flags_to_string(wan_flags),
+			                 lan_last_seen,
+			                 wan_last_seen);
 		}
-
-		table.insert_row(it->second,
-		                 ipv6_source,
-		                 ipv4_source,
-		                 ipv6_destination.get_mapped_ipv4_address().toString().data(),
-		                 proto_to_string(proto).data(),
-		                 port_source,
-		                 wan_port_source,
-		                 port_destination,
-		                 tcp_flags_to_string(lan_flags),
-		                 tcp_flags_to_string(wan_flags),
-		                 lan_last_seen,
-		                 wan_last_seen);
-	}
+		cursor = next_cursor;
+	} while (cursor);
 
 	table.Print();
 }
@@ -2,6 +2,7 @@
 
 #include "cli/helper.h"
 #include "common/idataplane.h"
+#include "common/sdpclient.h"
 
 namespace neighbor
 {
@@ -20,6 +21,20 @@ void show()
 	                  {.optional_null = "static"});
 }
 
+/// Reads the copy of the table published by the dataplane in shared memory, without the bus.
+void show_shm()
+{
+	const auto response = common::sdp::SdpClient::GetNeighborTable();
+
+	FillAndPrintTable({"route_name",
+	                   "interface_name",
+	                   "ip_address",
+	                   "mac_address",
+	                   "last_update"},
+	                  response,
+	                  {.optional_null = "static"});
+}
+
 void insert(const std::string& route_name,
             const std::string& interface_name,
             const common::ip_address_t& ip_address,
@@ -517,7 +517,7 @@ static void list_fw_rules(unsigned int mask, bool list)
 	common::icp::getFwLabels::response labels;
 	interface::controlPlane controlPlane;
 
-	TablePrinter table;
+	TablePrinter table({}, TablePrinter::stream_sample_rows);
 	if (list)
 	{
 		table.insert_row("id",
@@ -631,6 +631,97 @@ inline void fwlist(std::optional<std::string> str)
 	}
 }
 
+inline void fw_states(std::optional<uint8_t> filter_proto,
+                      std::optional<common::ip_prefix_t> filter_src_prefix,
+                      std::optional<common::ip_prefix_t> filter_dst_prefix,
+                      std::optional<uint16_t> filter_src_port,
+                      std::optional<uint16_t> filter_dst_port)
+{
+	constexpr uint32_t page_limit = 4096;
+
+	interface::controlPlane controlPlane;
+
+	TablePrinter table({}, TablePrinter::stream_sample_rows);
+	table.insert_row("proto",
+	                 "src_addr",
+	                 "src_port",
+	                 "dst_addr",
+	                 "dst_port",
+	                 "owner",
+	                 "flags",
+	                 "last_seen",
+	                 "packets_forward",
+	                 "packets_backward");
+
+	common::icp::get_fw_states::filter_t filter{filter_proto,
+	                                            filter_src_prefix,
+	                                            filter_dst_prefix,
+	                                            filter_src_port,
+	                                            filter_dst_port};
+	std::optional<common::icp::get_fw_states::key_t> cursor;
+	do
+	{
+		const auto [states, next_cursor] = controlPlane.get_fw_states({filter, cursor, page_limit});
+		for (const auto& [key, value] : states)
+		{
+			const auto& [proto, src_addr, dst_addr, src_port, dst_port] = key;
+			const auto& [owner, flags, last_seen, packets_backward, packets_forward] = value;
+
+			table.insert_row(proto,
+			                 src_addr,
+			                 src_port,
+			                 dst_addr,
+			                 dst_port,
+			                 owner == (uint8_t)common::fwstate::owner_e::internal ? "internal" : "external",
+			                 common::fwstate::flags_to_string(flags) + ":" + common::fwstate::flags_to_string(flags >> 4),
+			                 last_seen,
+			                 packets_forward,
+			                 packets_backward);
+		}
+		cursor = next_cursor;
+	} while (cursor);
+
+	table.Print();
+}
+
+/// Renders worker statistics from shared memory, unlike `dataplane report`
+/// it doesn't request dataplane.
+inline void report()
+{
+	const auto snapshot = common::sdp::SdpClient::GetStatsSnapshot();
+
+	nlohmann::json json;
+	for (const auto& [core_id, worker] : snapshot.workers)
+	{
+		nlohmann::json json_worker;
+		json_worker["coreId"] = core_id;
+		json_worker["counters"] = worker.counters;
+		json_worker["bursts"] = worker.bursts;
+
+		for (tPortId port_id = 0;
+		     port_id < worker.ports.size();
+		     port_id++)
+		{
+			nlohmann::json json_port;
+			json_port["portId"] = port_id;
+			json_port["physicalPort_egress_drops"] = worker.ports[port_id].physicalPort_egress_drops;
+			json_worker["statsPorts"].emplace_back(json_port);
+		}
+
+		json["workers"].emplace_back(json_worker);
+	}
+
+	for (const auto& [core_id, counters] : snapshot.workers_gc)
+	{
+		nlohmann::json json_worker_gc;
+		json_worker_gc["coreId"] = core_id;
+		json_worker_gc["counters"] = counters;
+		json["worker_gcs"].emplace_back(json_worker_gc);
+	}
+
+	std::cout << json.dump(2) << std::endl;
+}
+
 inline void errors()
 {
 	interface::dataPlane dataPlane;
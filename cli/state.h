@@ -0,0 +1,32 @@
+#pragma once
+
+#include <string>
+
+#include "common/idataplane.h"
+
+namespace state
+{
+
+/// Saves firewall, nat64stateful and balancer states of the running dataplane to file.
+inline void export_file(const std::string& path)
+{
+	interface::dataPlane dataplane;
+	const auto result = dataplane.state_export(path);
+	if (result != eResult::success)
+	{
+		throw std::string(common::result_to_c_str(result));
+	}
+}
+
+/// Loads states saved by another dataplane process, existing states are kept.
+inline void import_file(const std::string& path)
+{
+	interface::dataPlane dataplane;
+	const auto result = dataplane.state_import(path);
+	if (result != eResult::success)
+	{
+		throw std::string(common::result_to_c_str(result));
+	}
+}
+
+}
@@ -7,11 +7,33 @@
 #include "common/utils.h"
 #include "converter.h"
 
+/// Prints rows as a table aligned by columns, or as json when YANET_FORMAT=json.
+///
+/// Rows are kept in memory until Print(), unless the output is streamed:
+/// - YANET_FORMAT=jsonl and YANET_FORMAT=csv print every row as soon as it is inserted;
+/// - a table with non-zero `sample_rows` computes column widths over the header and
+///   the first `sample_rows` data rows, and prints the rest immediately, longer cells
+///   break alignment.
+///
+/// Streaming bounds memory only when rows are inserted as they arrive: commands should
+/// request paged responses (e.g. `fw states`, `nat64stateful state`) instead of one
+/// full response.
 class TablePrinter
 {
 public:
-	TablePrinter(const converter::config_t config = {}) :
-	        config_(config) {}
+	/// Rows sampled for column widths by commands with potentially huge output.
+	static constexpr size_t stream_sample_rows = 1024;
+
+	TablePrinter(const converter::config_t config = {},
+	             const size_t sample_rows = 0) :
+	        config_(config),
+	        sample_rows_(sample_rows)
+	{
+		if (const char* format_pointer = std::getenv("YANET_FORMAT"))
+		{
+			format_ = format_pointer;
+		}
+	}
 
 	// Insert arbitrary number of values as one row
 	template<typename... Args>
@@ -74,13 +96,23 @@ public:
 
 	void Print()
 	{
-		std::string format;
-		if (const char* format_pointer = std::getenv("YANET_FORMAT"))
+		if (format_ == "jsonl" || format_ == "csv")
 		{
-			format = format_pointer;
+			std::cout << std::flush;
+		}
+		else if (format_ == "json")
+		{
+			print_json();
+		}
+		else if (sample_rows_)
+		{
+			flush_sample();
+			std::cout << std::flush;
+		}
+		else
+		{
+			print_default();
 		}
-
-		(format == "json") ? print_json() : print_default();
 	}
 
 	void Render()
@@ -94,6 +126,33 @@ public:
 private:
 	void insert_row(std::vector<std::string>&& row)
 	{
+		if (format_ == "jsonl")
+		{
+			stream_jsonl(std::move(row));
+			return;
+		}
+		else if (format_ == "csv")
+		{
+			print_csv(row);
+			return;
+		}
+
+		/// the sample is the header and `sample_rows_` data rows, a table of no more rows is printed as usual
+		if (sample_rows_ && table_.size() > sample_rows_)
+		{
+			flush_sample();
+		}
+
+		if (sampled_)
+		{
+			/// widths are already fixed
+			if (!columns_order_.empty())
+			{
+				print_row(row, columns_order_, false);
+			}
+			return;
+		}
+
 		if (row.size() > column_lengths_.size())
 		{
 			column_lengths_.resize(row.size(), 0);
@@ -110,6 +169,75 @@ private:
 		table_.push_back(std::move(row));
 	}
 
+	/// Prints sampled rows and fixes column widths for the next rows.
+	void flush_sample()
+	{
+		if (table_.empty() || sampled_)
+		{
+			return;
+		}
+
+		sampled_ = true;
+		columns_order_ = make_columns_order(table_.front());
+		if (!columns_order_.empty())
+		{
+			print_row(table_.front(), columns_order_, true);
+			for (size_t row_idx = 1; row_idx < table_.size(); ++row_idx)
+			{
+				print_row(table_[row_idx], columns_order_, false);
+			}
+		}
+
+		table_.clear();
+	}
+
+	void stream_jsonl(std::vector<std::string>&& row)
+	{
+		if (header_row_.empty())
+		{
+			header_row_ = std::move(row);
+			return;
+		}
+
+		nlohmann::json json_row;
+		for (size_t idx = 0; idx < row.size() && idx < header_row_.size(); ++idx)
+		{
+			json_row[header_row_[idx]] = row[idx];
+		}
+
+		std::cout << json_row.dump() << '\n';
+	}
+
+	void print_csv(const std::vector<std::string>& row)
+	{
+		for (size_t idx = 0; idx < row.size(); ++idx)
+		{
+			if (idx)
+			{
+				std::cout << ',';
+			}
+
+			const auto& cell = row[idx];
+			if (cell.find_first_of(",\"\r\n") == std::string::npos)
+			{
+				std::cout << cell;
+				continue;
+			}
+
+			std::cout << '"';
+			for (const char symbol : cell)
+			{
+				if (symbol == '"')
+				{
+					std::cout << '"';
+				}
+				std::cout << symbol;
+			}
+			std::cout << '"';
+		}
+		std::cout << '\n';
+	}
+
 	void print_default()
 	{
 		if (table_.empty() || column_lengths_.empty())
@@ -117,6 +245,26 @@ private:
 			return;
 		}
 
+		// The header row contains the table's column names
+		const auto& header_row = table_.front();
+
+		const auto columns_order = make_columns_order(header_row);
+		if (columns_order.empty())
+		{
+			return;
+		}
+
+		print_row(header_row, columns_order, true);
+
+		for (size_t row_idx = 1; row_idx < table_.size(); ++row_idx)
+		{
+			const auto& row = table_[row_idx];
+			print_row(row, columns_order, false);
+		}
+	}
+
+	std::vector<size_t> make_columns_order(const std::vector<std::string>& header_row)
+	{
 		std::vector<std::string> user_selected_col_names;
 		if (const char* columns_pointer = std::getenv("YANET_FORMAT_COLUMNS"))
 		{
@@ -125,9 +273,6 @@ private:
 
 		bool print_selected_cols_only = !user_selected_col_names.empty();
 
-		// The header row contains the table's column names
-		const auto& header_row = table_.front();
-
 		/*
 		 * If the user has specified certain columns to be printed in a specific order,
 		 * we need to map each column's index from the user-provided list to its corresponding
@@ -175,18 +320,7 @@ private:
 			std::iota(columns_order.begin(), columns_order.end(), 0);
 		}
 
-		if (columns_order.empty())
-		{
-			return;
-		}
-
-		print_row(header_row, columns_order, true);
-
-		for (size_t row_idx = 1; row_idx < table_.size(); ++row_idx)
-		{
-			const auto& row = table_[row_idx];
-			print_row(row, columns_order, false);
-		}
+		return columns_order;
 	}
 
 	void print_json()
@@ -311,6 +445,11 @@ private:
 	}
 
 	converter::config_t config_;
+	std::string format_;
+	size_t sample_rows_;
 	std::vector<std::vector<std::string>> table_;
 	std::vector<size_t> column_lengths_;
+	bool sampled_{};
+	std::vector<size_t> columns_order_; ///< fixed after sampling
+	std::vector<std::string> header_row_; ///< jsonl
 };
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <fstream>
+
 #include "common/counters.h"
 #include "common/icontrolplane.h"
 #include "common/idataplane.h"
@@ -145,7 +147,10 @@ void unsafe()
 		       "acl_ingress_dropPackets=%luu,"
 		       "acl_egress_dropPackets=%luu,"
 		       "log_drops=%luu,"
-		       "log_packets=%luu\n",
+		       "log_packets=%luu,"
+		       "idle_iterations=%luu,"
+		       "idle_sleep_us=%luu,"
+		       "repeat_packets=%luu\n",
 		       coreId,
 		       iterations,
 		       stats.brokenPackets,
@@ -176,7 +181,10 @@ void unsafe()
 		       stats.acl_ingress_dropPackets,
 		       stats.acl_egress_dropPackets,
 		       stats.logs_drops,
-		       stats.logs_packets);
+		       stats.logs_packets,
+		       stats.idle_iterations,
+		       stats.idle_sleep_us,
+		       stats.repeat_packets);
 
 		printf("worker,coreId=all "
 		       "acl_ingress_dropPackets=%luu,"
@@ -650,6 +658,35 @@ void mappings()
 	}
 }
 
+/// Prints only mappings whose counters changed since previous call, without ipv6 tag.
+/// Cursor of previous call is kept in file `cursor_path`, use separate file for each scraper.
+void mappings_delta(const std::string& cursor_path)
+{
+	common::icp::telegraf_mappings_delta::request cursor = 0;
+	{
+		std::ifstream cursor_file(cursor_path);
+		cursor_file >> cursor;
+	}
+
+	interface::controlPlane controlPlane;
+	const auto [cursor_next, flag_full, mappings] = controlPlane.telegraf_mappings_delta(cursor);
+	GCC_BUG_UNUSED(flag_full);
+
+	for (const auto& [module, ipv4_address, stats] : mappings)
+	{
+		influxdb_format::print("tun64",
+		                       {{"name", module},
+		                        {"ipv4", ipv4_address}},
+		                       {{"encap_packets", stats.encap_packets},
+		                        {"encap_bytes", stats.encap_bytes},
+		                        {"decap_packets", stats.decap_packets},
+		                        {"decap_bytes", stats.decap_bytes}});
+	}
+
+	std::ofstream cursor_file(cursor_path, std::ios::trunc);
+	cursor_file << cursor_next << std::endl;
+}
+
 namespace balancer
 {
 
@@ -0,0 +1,136 @@
+#include <cstdlib>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "cli/table_printer.h"
+
+namespace
+{
+
+class TablePrinterTest : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		unsetenv("YANET_FORMAT");
+		unsetenv("YANET_FORMAT_COLUMNS");
+		previous = std::cout.rdbuf(output.rdbuf());
+	}
+
+	void TearDown() override
+	{
+		std::cout.rdbuf(previous);
+		unsetenv("YANET_FORMAT");
+	}
+
+	std::string take_output()
+	{
+		std::string result = output.str();
+		output.str({});
+		return result;
+	}
+
+	std::ostringstream output;
+	std::streambuf* previous{};
+};
+
+TEST_F(TablePrinterTest, Default)
+{
+	TablePrinter table;
+	table.insert_row("id", "name");
+	table.insert_row(1, "first");
+	table.insert_row(100, "x");
+
+	EXPECT_EQ("", take_output());
+
+	table.Print();
+	EXPECT_EQ("id   name\n"
+	          "---  -----\n"
+	          "1    first\n"
+	          "100  x\n",
+	          take_output());
+}
+
+TEST_F(TablePrinterTest, Sampled)
+{
+	TablePrinter table({}, 2);
+	table.insert_row("id", "name");
+	table.insert_row(1, "a");
+	table.insert_row(2, "b");
+	EXPECT_EQ("", take_output());
+
+	/// sample is full: widths are fixed
+	table.insert_row(300, "c");
+	EXPECT_EQ("id  name\n"
+	          "--  ----\n"
+	          "1   a\n"
+	          "2   b\n"
+	          "300  c\n",
+	          take_output());
+
+	table.insert_row(4, "d");
+	EXPECT_EQ("4   d\n", take_output());
+
+	table.Print();
+	EXPECT_EQ("", take_output());
+}
+
+TEST_F(TablePrinterTest, SampledExact)
+{
+	TablePrinter table({}, 2);
+	table.insert_row("id", "name");
+	table.insert_row(1, "a");
+	table.insert_row(200, "b");
+	EXPECT_EQ("", take_output());
+
+	table.Print();
+	EXPECT_EQ("id   name\n"
+	          "---  ----\n"
+	          "1    a\n"
+	          "200  b\n",
+	          take_output());
+}
+
+TEST_F(TablePrinterTest, SampledShort)
+{
+	TablePrinter table({}, 16);
+	table.insert_row("id", "name");
+	table.insert_row(1, "a");
+
+	table.Print();
+	EXPECT_EQ("id  name\n"
+	          "--  ----\n"
+	          "1   a\n",
+	          take_output());
+}
+
+TEST_F(TablePrinterTest, JsonLines)
+{
+	setenv("YANET_FORMAT", "jsonl", 1);
+
+	TablePrinter table;
+	table.insert_row("id", "name");
+	table.insert_row(1, "first");
+	EXPECT_EQ("{\"id\":\"1\",\"name\":\"first\"}\n", take_output());
+
+	table.insert_row(2, "second");
+	EXPECT_EQ("{\"id\":\"2\",\"name\":\"second\"}\n", take_output());
+}
+
+TEST_F(TablePrinterTest, Csv)
+{
+	setenv("YANET_FORMAT", "csv", 1);
+
+	TablePrinter table;
+	table.insert_row("id", "name");
+	table.insert_row(1, "a,b");
+	table.insert_row(2, "say \"hi\"");
+
+	EXPECT_EQ("id,name\n"
+	          "1,\"a,b\"\n"
+	          "2,\"say \"\"hi\"\"\"\n",
+	          take_output());
+}
+
+} // namespace
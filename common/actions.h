@@ -140,6 +140,54 @@ struct hit_count_t
 	tCounterId counter_id;
 };
 
+struct rate_limit_t
+{
+	rate_limit_t() :
+	        meter(""),
+	        rate(0),
+	        burst(0),
+	        meter_id(0),
+	        counter_id(0)
+	{}
+
+	rate_limit_t(std::string meter, uint32_t rate, uint32_t burst) :
+	        meter(std::move(meter)),
+	        rate(rate),
+	        burst(burst),
+	        meter_id(0),
+	        counter_id(0)
+	{}
+
+	bool operator==(const rate_limit_t& o) const
+	{
+		return std::tie(meter, rate, burst, meter_id, counter_id) ==
+		       std::tie(o.meter, o.rate, o.burst, o.meter_id, o.counter_id);
+	}
+
+	bool operator!=(const rate_limit_t& o) const
+	{
+		return !operator==(o);
+	}
+
+	bool operator<(const rate_limit_t& o) const
+	{
+		return std::tie(meter, rate, burst, meter_id, counter_id) <
+		       std::tie(o.meter, o.rate, o.burst, o.meter_id, o.counter_id);
+	}
+
+	SERIALIZABLE(meter, rate, burst, meter_id, counter_id);
+
+	// Name of a meter, rules with the same name share one meter
+	std::string meter;
+	// Packets per second and burst size of the meter, for all workers
+	uint32_t rate;
+	uint32_t burst;
+	// Id of a meter in acl_meters array in dataplane globalbase
+	uint32_t meter_id;
+	// Id of a related counter in aclCounters array in dataplane cWorker class (counts dropped packets)
+	tCounterId counter_id;
+};
+
 } // namespace acl
 
 // TODO: When rewriting the current ACL library into LibFilter, we could consider using inheritance.
@@ -305,7 +353,41 @@ struct HitCountAction final
 	}
 };
 
-using RawAction = std::variant<FlowAction, DumpAction, CheckStateAction, StateTimeoutAction, HitCountAction>;
+/**
+ * @brief Represents an action that drops packets exceeding the rate of a meter.
+ *
+ * Packets within the rate continue through the path.
+ */
+struct RateLimitAction final
+{
+	// Maximum count of RateLimitAction objects allowed in a path.
+	static constexpr size_t MAX_COUNT = 8;
+	// Id of a meter in acl_meters array in dataplane globalbase
+	uint32_t meter_id;
+	// Id of a related counter in aclCounters array in dataplane cWorker class
+	tCounterId counter_id;
+
+	RateLimitAction(const acl::rate_limit_t& rate_limit_action) :
+	        meter_id(rate_limit_action.meter_id),
+	        counter_id(rate_limit_action.counter_id){};
+
+	RateLimitAction() :
+	        meter_id(0),
+	        counter_id(0){};
+
+	[[nodiscard]] bool terminating() const { return false; }
+
+	SERIALIZABLE(meter_id, counter_id);
+
+	[[nodiscard]] std::string to_string() const
+	{
+		std::ostringstream oss;
+		oss << "RateLimitAction(meter_id=" << meter_id << ", counter_id=" << counter_id << ")";
+		return oss.str();
+	}
+};
+
+using RawAction = std::variant<FlowAction, DumpAction, CheckStateAction, StateTimeoutAction, HitCountAction, RateLimitAction>;
 
 /**
  * @brief Represents a generic action.
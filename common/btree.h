@@ -1,38 +1,83 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <functional>
+#include <optional>
+#include <vector>
 
 #include "type.h"
 
 namespace common
 {
 
+/// Prefix tree with path compression (patricia trie).
+///
+/// Node is created only for stored prefix or for branching of two subtrees, and keeps
+/// its masked prefix. Nodes are placed in one vector and linked by indexes, removed
+/// nodes are reused.
 template<typename key_T,
          typename value_T>
 class btree
 {
 public:
-	btree() :
-	        root(nullptr)
-	{
-	}
-
-	~btree()
-	{
-		delete root;
-	}
+	btree() = default;
 
 public:
-	void insert(const key_T& key,
+	void insert(const key_T& key_orig,
 	            const uint32_t& key_bits,
 	            const value_T& value)
 	{
-		if (!root)
+		const key_T key = key_orig.applyMask(key_bits);
+
+		uint32_t parent_id = node_null;
+		uint8_t parent_bit = 0;
+		uint32_t bits_checked = 0;
+		for (;;)
 		{
-			root = new node_t();
-		}
+			const uint32_t node_id = link(parent_id, parent_bit);
+			if (node_id == node_null)
+			{
+				const auto new_id = node_create(key, key_bits, value);
+				link(parent_id, parent_bit) = new_id;
+				return;
+			}
+
+			const auto& node = nodes[node_id];
+			const uint32_t diff = diff_bit(key, node.key, bits_checked, std::min(node.bits, key_bits));
+			if (diff == node.bits)
+			{
+				if (node.bits == key_bits)
+				{
+					nodes[node_id].value = value;
+					return;
+				}
+
+				parent_id = node_id;
+				parent_bit = key.get_bit(node.bits);
+				bits_checked = node.bits;
+				continue;
+			}
 
-		root->insert(key, key_bits, 0, value);
+			const uint8_t node_bit = node.key.get_bit(diff);
+
+			if (diff == key_bits)
+			{
+				/// new prefix covers node
+				const auto new_id = node_create(key, key_bits, value);
+				nodes[new_id].nexts[node_bit] = node_id;
+				link(parent_id, parent_bit) = new_id;
+				return;
+			}
+
+			/// branch at first different bit
+			const auto branch_id = node_create(key.applyMask(diff), diff, std::nullopt);
+			const auto new_id = node_create(key, key_bits, value);
+			nodes[branch_id].nexts[node_bit] = node_id;
+			nodes[branch_id].nexts[node_bit ^ 1] = new_id;
+			link(parent_id, parent_bit) = branch_id;
+			return;
+		}
 	}
 
 	template<typename prefix_T>
@@ -47,12 +92,66 @@ public:
 	void remove(const key_T& key,
 	            const uint32_t& key_bits)
 	{
-		if (!root)
+		uint32_t grandparent_id = node_null;
+		uint8_t grandparent_bit = 0;
+		uint32_t parent_id = node_null;
+		uint8_t parent_bit = 0;
+		uint32_t bits_checked = 0;
+
+		uint32_t node_id = root;
+		while (node_id != node_null)
+		{
+			const auto& node = nodes[node_id];
+			if (node.bits > key_bits ||
+			    diff_bit(key, node.key, bits_checked, node.bits) != node.bits)
+			{
+				return;
+			}
+
+			if (node.bits == key_bits)
+			{
+				break;
+			}
+
+			grandparent_id = parent_id;
+			grandparent_bit = parent_bit;
+			parent_id = node_id;
+			parent_bit = key.get_bit(node.bits);
+			bits_checked = node.bits;
+			node_id = node.nexts[parent_bit];
+		}
+
+		if (node_id == node_null)
+		{
+			return;
+		}
+
+		auto& node = nodes[node_id];
+		node.value.reset();
+
+		if (node.nexts[0] != node_null &&
+		    node.nexts[1] != node_null)
+		{
+			/// keep as branch
+			return;
+		}
+
+		link(parent_id, parent_bit) = node.nexts[0] != node_null ? node.nexts[0] : node.nexts[1];
+		node_free(node_id);
+
+		if (parent_id == node_null)
 		{
 			return;
 		}
 
-		root->remove(key, key_bits, 0);
+		/// parent without value and with one child is not needed
+		auto& parent = nodes[parent_id];
+		if (!parent.value &&
+		    (parent.nexts[0] == node_null || parent.nexts[1] == node_null))
+		{
+			link(grandparent_id, grandparent_bit) = parent.nexts[0] != node_null ? parent.nexts[0] : parent.nexts[1];
+			node_free(parent_id);
+		}
 	}
 
 	template<typename prefix_T>
@@ -64,25 +163,21 @@ public:
 
 	void clear()
 	{
-		if (!root)
-		{
-			return;
-		}
-
-		delete root;
-		root = nullptr;
+		nodes.clear();
+		nodes_free.clear();
+		root = node_null;
 	}
 
 	std::optional<value_T> get(const key_T& key,
 	                           const uint32_t& key_bits) const
 	{
-		if (!root)
-		{
-			return std::nullopt;
-		}
-
 		std::optional<value_T> result;
-		root->get(key, key_bits, 0, result);
+		walk(key, key_bits, [&](const node_t& node) {
+			if (node.bits == key_bits)
+			{
+				result = node.value;
+			}
+		});
 		return result;
 	}
 
@@ -95,27 +190,21 @@ public:
 
 	std::vector<std::tuple<key_T, uint32_t>> get_all_top() const
 	{
-		if (!root)
-		{
-			return {};
-		}
-
-		key_T key;
 		std::vector<std::tuple<key_T, uint32_t>> result;
-		root->get_all_top(key, 0, result);
+		get_all_top(root, result);
 		return result;
 	}
 
 	std::optional<std::tuple<value_T, uint32_t>> lookup(const key_T& key,
 	                                                    const uint32_t& key_bits) const
 	{
-		if (!root)
-		{
-			return std::nullopt;
-		}
-
 		std::optional<std::tuple<value_T, uint32_t>> result;
-		root->lookup(key, key_bits, 0, result);
+		walk(key, key_bits, [&](const node_t& node) {
+			if (node.value)
+			{
+				result = {*node.value, node.bits};
+			}
+		});
 		return result;
 	}
 
@@ -130,276 +219,238 @@ public:
 	                const uint32_t& key_bits,
 	                const std::function<void(const value_T&, const uint32_t)>& callback) const
 	{
-		if (!root)
-		{
-			return;
-		}
-
-		root->lookup_all(key, key_bits, 0, callback);
+		walk(key, key_bits, [&](const node_t& node) {
+			if (node.value)
+			{
+				callback(*node.value, node.bits);
+			}
+		});
 	}
 
+	/// Calls callback for longest prefix which covers key (with key itself),
+	/// then for all prefixes more specific than key.
 	void lookup_deep(const key_T& key,
 	                 const uint32_t& key_bits,
 	                 const std::function<void(const key_T&, const uint32_t, const value_T&)>& callback) const
 	{
-		if (!root)
+		std::optional<value_T> value_cover;
+		std::array<uint32_t, 2> subtree_ids{node_null, node_null}; ///< more specific prefixes
+
+		uint32_t bits_checked = 0;
+		uint32_t node_id = root;
+		while (node_id != node_null)
 		{
-			return;
+			const auto& node = nodes[node_id];
+			if (node.bits > key_bits)
+			{
+				if (diff_bit(key, node.key, bits_checked, key_bits) == key_bits)
+				{
+					subtree_ids[0] = node_id;
+				}
+				break;
+			}
+
+			if (diff_bit(key, node.key, bits_checked, node.bits) != node.bits)
+			{
+				break;
+			}
+
+			if (node.value)
+			{
+				value_cover = node.value;
+			}
+
+			if (node.bits == key_bits)
+			{
+				subtree_ids = node.nexts;
+				break;
+			}
+
+			bits_checked = node.bits;
+			node_id = node.nexts[key.get_bit(node.bits)];
 		}
 
-		key_T key_temp = key;
-		root->lookup_deep(key_temp, key_bits, 0, callback, std::nullopt);
+		if (value_cover)
+		{
+			callback(key, key_bits, *value_cover);
+		}
+
+		lookup_deep_subtree(subtree_ids[0], callback);
+		lookup_deep_subtree(subtree_ids[1], callback);
+	}
+
+	/// Returns count of nodes, for tests and stats.
+	[[nodiscard]] size_t nodes_size() const
+	{
+		return nodes.size() - nodes_free.size();
 	}
 
 protected:
-	class node_t
+	constexpr static uint32_t node_null = 0xFFFFFFFFu;
+
+	struct node_t
 	{
-	public:
-		node_t() :
-		        nexts{nullptr, nullptr}
-		{
-		}
+		key_T key; ///< bits after `bits` are zero
+		uint32_t bits;
+		std::array<uint32_t, 2> nexts;
+		std::optional<value_T> value;
+	};
 
-		~node_t()
+	/// Returns index of first different bit in [from, to), or `to`.
+	static uint32_t diff_bit(const key_T& first,
+	                         const key_T& second,
+	                         uint32_t from,
+	                         const uint32_t to)
+	{
+		if (from >= to)
 		{
-			delete nexts[0];
-			delete nexts[1];
+			return to;
 		}
 
-	public:
-		void insert(const key_T& key,
-		            const uint32_t& key_bits,
-		            const uint32_t& key_bits_current,
-		            const value_T& value)
+		if constexpr (std::is_same_v<key_T, ipv4_address_t>)
 		{
-			if (key_bits_current == key_bits)
-			{
-				this->value = value;
-			}
-			else
-			{
-				auto*& next = nexts[key.get_bit(key_bits_current)];
-
-				if (!next)
-				{
-					next = new node_t();
-				}
-
-				next->insert(key, key_bits, key_bits_current + 1, value);
-			}
+			const uint32_t diff = ((uint32_t)first ^ (uint32_t)second) & (0xFFFFFFFFu >> from);
+			return diff ? std::min((uint32_t)__builtin_clz(diff), to) : to;
 		}
-
-		void remove(const key_T& key,
-		            const uint32_t& key_bits,
-		            const uint32_t& key_bits_current)
+		else if constexpr (std::is_same_v<key_T, ipv6_address_t>)
 		{
-			if (key_bits_current == key_bits)
-			{
-				value.reset();
-				return;
-			}
-			else
+			for (uint32_t offset = (from / 64) * 64; offset < to; offset += 64)
 			{
-				auto*& next = nexts[key.get_bit(key_bits_current)];
-
-				if (!next)
+				uint64_t diff = first.getAddress64(offset) ^ second.getAddress64(offset);
+				if (from > offset)
 				{
-					return;
+					diff &= 0xFFFFFFFFFFFFFFFFull >> (from - offset);
 				}
 
-				next->remove(key, key_bits, key_bits_current + 1);
-
-				if (!(next->value ||
-				      next->nexts[0] ||
-				      next->nexts[1]))
+				if (diff)
 				{
-					delete next;
-					next = nullptr;
+					return std::min(offset + __builtin_clzll(diff), to);
 				}
 			}
-		}
 
-		void get(const key_T& key,
-		         const uint32_t& key_bits,
-		         const uint32_t& key_bits_current,
-		         std::optional<value_T>& result) const
+			return to;
+		}
+		else
 		{
-			if (key_bits_current == key_bits)
+			for (; from < to; from++)
 			{
-				result = value;
-			}
-			else
-			{
-				auto* const& next = nexts[key.get_bit(key_bits_current)];
-
-				if (!next)
+				if (first.get_bit(from) != second.get_bit(from))
 				{
-					return;
+					break;
 				}
-
-				next->get(key, key_bits, key_bits_current + 1, result);
 			}
+
+			return from;
 		}
+	}
 
-		void get_all_top(key_T& key,
-		                 const uint32_t& key_bits_current,
-		                 std::vector<std::tuple<key_T, uint32_t>>& result) const
+	uint32_t& link(const uint32_t parent_id,
+	               const uint8_t parent_bit)
+	{
+		if (parent_id == node_null)
 		{
-			if (value)
-			{
-				result.emplace_back(key, key_bits_current);
-				return;
-			}
+			return root;
+		}
 
-			if (nexts[0])
-			{
-				nexts[0]->get_all_top(key, key_bits_current + 1, result);
-			}
+		return nodes[parent_id].nexts[parent_bit];
+	}
 
-			if (nexts[1])
-			{
-				key.set_bit(key_bits_current, 1);
-				nexts[1]->get_all_top(key, key_bits_current + 1, result);
-				key.set_bit(key_bits_current, 0);
-			}
+	uint32_t node_create(const key_T& key,
+	                     const uint32_t bits,
+	                     const std::optional<value_T>& value)
+	{
+		uint32_t node_id;
+		if (!nodes_free.empty())
+		{
+			node_id = nodes_free.back();
+			nodes_free.pop_back();
 		}
-
-		void lookup(const key_T& key,
-		            const uint32_t& key_bits,
-		            const uint32_t& key_bits_current,
-		            std::optional<std::tuple<value_T, uint32_t>>& result) const
+		else
 		{
-			if (value)
-			{
-				result = {*value, key_bits_current};
-			}
-
-			if (key_bits_current == key_bits)
-			{
-				/// nothing
-			}
-			else
-			{
-				auto* const& next = nexts[key.get_bit(key_bits_current)];
+			node_id = nodes.size();
+			nodes.emplace_back();
+		}
 
-				if (!next)
-				{
-					return;
-				}
+		nodes[node_id] = {key, bits, {node_null, node_null}, value};
+		return node_id;
+	}
 
-				next->lookup(key, key_bits, key_bits_current + 1, result);
-			}
-		}
+	void node_free(const uint32_t node_id)
+	{
+		nodes[node_id].value.reset();
+		nodes_free.emplace_back(node_id);
+	}
 
-		void lookup_all(const key_T& key,
-		                const uint32_t& key_bits,
-		                const uint32_t& key_bits_current,
-		                const std::function<void(const value_T&, const uint32_t)>& callback) const
+	/// Calls callback for nodes which are prefixes of key, from shortest.
+	template<typename callback_T>
+	void walk(const key_T& key,
+	          const uint32_t key_bits,
+	          const callback_T& callback) const
+	{
+		uint32_t bits_checked = 0;
+		uint32_t node_id = root;
+		while (node_id != node_null)
 		{
-			if (value)
+			const auto& node = nodes[node_id];
+			if (node.bits > key_bits ||
+			    diff_bit(key, node.key, bits_checked, node.bits) != node.bits)
 			{
-				callback(*value, key_bits_current);
+				return;
 			}
 
-			if (key_bits_current == key_bits)
+			callback(node);
+
+			if (node.bits == key_bits)
 			{
 				return;
 			}
-			else
-			{
-				auto* const& next = nexts[key.get_bit(key_bits_current)];
-
-				if (!next)
-				{
-					return;
-				}
 
-				next->lookup_all(key, key_bits, key_bits_current + 1, callback);
-			}
+			bits_checked = node.bits;
+			node_id = node.nexts[key.get_bit(node.bits)];
 		}
+	}
 
-		void lookup_deep(key_T& key,
-		                 const uint32_t& key_bits,
-		                 const uint32_t& key_bits_current,
-		                 const std::function<void(const key_T&, const uint32_t, const value_T&)>& callback,
-		                 const std::optional<value_T>& value_prev) const
+	void get_all_top(const uint32_t node_id,
+	                 std::vector<std::tuple<key_T, uint32_t>>& result) const
+	{
+		if (node_id == node_null)
 		{
-			if (key_bits_current == key_bits)
-			{
-				if (value)
-				{
-					callback(key, key_bits_current, *value);
-				}
-				else if (value_prev)
-				{
-					callback(key, key_bits_current, *value_prev);
-				}
-
-				if (nexts[0])
-				{
-					nexts[0]->lookup_deep(key, key_bits, key_bits_current + 1, callback, std::nullopt);
-				}
-
-				if (nexts[1])
-				{
-					key.set_bit(key_bits_current, 1);
-					nexts[1]->lookup_deep(key, key_bits, key_bits_current + 1, callback, std::nullopt);
-					key.set_bit(key_bits_current, 0);
-				}
-			}
-			else if (key_bits_current > key_bits)
-			{
-				if (value)
-				{
-					callback(key, key_bits_current, *value);
-				}
+			return;
+		}
 
-				if (nexts[0])
-				{
-					nexts[0]->lookup_deep(key, key_bits, key_bits_current + 1, callback, std::nullopt);
-				}
+		const auto& node = nodes[node_id];
+		if (node.value)
+		{
+			result.emplace_back(node.key, node.bits);
+			return;
+		}
 
-				if (nexts[1])
-				{
-					key.set_bit(key_bits_current, 1);
-					nexts[1]->lookup_deep(key, key_bits, key_bits_current + 1, callback, std::nullopt);
-					key.set_bit(key_bits_current, 0);
-				}
-			}
-			else
-			{
-				auto* const& next = nexts[key.get_bit(key_bits_current)];
+		get_all_top(node.nexts[0], result);
+		get_all_top(node.nexts[1], result);
+	}
 
-				if (!next)
-				{
-					if (value)
-					{
-						callback(key, key_bits, *value);
-					}
-					else if (value_prev)
-					{
-						callback(key, key_bits, *value_prev);
-					}
-					return;
-				}
+	void lookup_deep_subtree(const uint32_t node_id,
+	                         const std::function<void(const key_T&, const uint32_t, const value_T&)>& callback) const
+	{
+		if (node_id == node_null)
+		{
+			return;
+		}
 
-				if (value)
-				{
-					next->lookup_deep(key, key_bits, key_bits_current + 1, callback, value);
-				}
-				else
-				{
-					next->lookup_deep(key, key_bits, key_bits_current + 1, callback, value_prev);
-				}
-			}
+		const auto& node = nodes[node_id];
+		if (node.value)
+		{
+			callback(node.key, node.bits, *node.value);
 		}
 
-	public:
-		std::optional<value_T> value;
-		std::array<node_t*, 2> nexts;
-	};
+		lookup_deep_subtree(node.nexts[0], callback);
+		lookup_deep_subtree(node.nexts[1], callback);
+	}
 
-	node_t* root;
+protected:
+	std::vector<node_t> nodes;
+	std::vector<uint32_t> nodes_free;
+	uint32_t root{node_null};
 };
 
 template<typename value_T>
@@ -457,6 +508,11 @@ public:
 		}
 	}
 
+	[[nodiscard]] size_t nodes_size() const
+	{
+		return btree_v4.nodes_size() + btree_v6.nodes_size();
+	}
+
 	[[nodiscard]] std::vector<ip_prefix_t> get_all_top() const
 	{
 		std::vector<ip_prefix_t> result;
@@ -70,6 +70,8 @@ static constexpr std::uint32_t YANET_BALANCER_WRR_SERVICE_SIZE = YANET_CONFIG_BA
 #define YANET_CONFIG_ACL_TREE_CHUNKS_BUCKET_SIZE (64 * 1024)
 #define YANET_CONFIG_DUMP_ID_SIZE (8)
 #define YANET_CONFIG_DUMP_ID_TO_TAG_SIZE (1024 * 1024)
+#define YANET_CONFIG_ACL_METERS_SIZE (1024)
+#define YANET_CONFIG_QOS_CLASSES_SIZE (4)
 #define YANET_CONFIG_SHARED_RINGS_NUMBER (32)
 #define YANET_DEFAULT_IPC_SHMKEY (12345)
 #define YANET_CONFIG_KERNEL_INTERFACE_QUEUE_SIZE (4096)
@@ -54,6 +54,11 @@ public:
 		return get<common::icp::requestType::telegraf_mappings, common::icp::telegraf_mappings::response>();
 	}
 
+	auto telegraf_mappings_delta(const common::icp::telegraf_mappings_delta::request& request) const
+	{
+		return get<common::icp::requestType::telegraf_mappings_delta, common::icp::telegraf_mappings_delta::response>(request);
+	}
+
 	common::icp::getPhysicalPorts::response getPhysicalPorts() const
 	{
 		return get<common::icp::requestType::getPhysicalPorts, common::icp::getPhysicalPorts::response>();
@@ -289,6 +294,11 @@ public:
 		return get<common::icp::requestType::getFwList, common::icp::getFwList::response>(request);
 	}
 
+	auto get_fw_states(const common::icp::get_fw_states::request& request) const
+	{
+		return get<common::icp::requestType::get_fw_states, common::icp::get_fw_states::response>(request);
+	}
+
 	auto getFwLabels() const
 	{
 		return get<common::icp::requestType::getFwLabels, common::icp::getFwLabels::response>();
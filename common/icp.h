@@ -88,6 +88,8 @@ enum class requestType : uint32_t
 	counters_stat,
 	route_counters,
 	route_tunnel_counters,
+	get_fw_states,
+	telegraf_mappings_delta,
 	size // size should always be at the bottom of the list, this enum allows us to find out the size of the enum list
 };
 
@@ -227,6 +229,10 @@ inline const char* requestType_toString(requestType t)
 			return "route_counters";
 		case requestType::route_tunnel_counters:
 			return "route_tunnel_counters";
+		case requestType::get_fw_states:
+			return "get_fw_states";
+		case requestType::telegraf_mappings_delta:
+			return "telegraf_mappings_delta";
 		case requestType::size:
 			return "unknown";
 	}
@@ -337,6 +343,22 @@ using mapping = std::tuple<std::string, ///< moduleName
 using response = std::vector<mapping>;
 }
 
+namespace telegraf_mappings_delta
+{
+/// cursor of previous response, zero for full response.
+/// Each reader keeps its own cursor, up to 8 readers are tracked,
+/// a cursor evicted by other readers gets full response
+using request = uint64_t;
+
+using mapping = std::tuple<std::string, ///< moduleName
+                           ipv4_address_t,
+                           common::tun64mapping::stats_t>;
+
+using response = std::tuple<uint64_t, ///< cursor
+                            uint8_t, ///< flagFull
+                            std::vector<mapping>>;
+}
+
 namespace getPhysicalPorts
 {
 using response = std::map<std::string,
@@ -894,6 +916,34 @@ using response = std::map<uint32_t, ///< rule number
                                                  std::string>>>; ///< rule text
 }
 
+namespace get_fw_states
+{
+using key_t = std::tuple<uint8_t, ///< proto
+                         common::ip_address_t, ///< src_addr
+                         common::ip_address_t, ///< dst_addr
+                         uint16_t, ///< src_port
+                         uint16_t>; ///< dst_port
+
+using value_t = std::tuple<uint8_t, ///< owner
+                           uint8_t, ///< flags
+                           uint32_t, ///< last_seen
+                           uint64_t, ///< packets backward
+                           uint64_t>; ///< packets forward
+
+using filter_t = std::tuple<std::optional<uint8_t>, ///< proto
+                            std::optional<common::ip_prefix_t>, ///< src_addr
+                            std::optional<common::ip_prefix_t>, ///< dst_addr
+                            std::optional<uint16_t>, ///< src_port
+                            std::optional<uint16_t>>; ///< dst_port
+
+using request = std::tuple<filter_t,
+                           std::optional<key_t>, ///< cursor: page starts from this key
+                           uint32_t>; ///< limit
+
+using response = std::tuple<std::map<key_t, value_t>,
+                            std::optional<key_t>>; ///< cursor of the next page, empty on the last page
+}
+
 namespace getSamples
 {
 using response = std::vector<std::tuple<std::string, ///< in_iface
@@ -962,8 +1012,10 @@ using request = std::tuple<requestType,
                                         resolve_fqdn_to_ip::request,
                                         getAclConfig::request,
                                         getFwList::request,
+                                        get_fw_states::request,
                                         loadConfig::request,
-                                        convert::request>>;
+                                        convert::request,
+                                        telegraf_mappings_delta::request>>;
 
 using response = std::variant<std::tuple<>,
                               telegraf_unsafe::response,
@@ -971,6 +1023,7 @@ using response = std::variant<std::tuple<>,
                               telegraf_dregress_traffic::response,
                               telegraf_balancer_service::response,
                               telegraf_mappings::response,
+                              telegraf_mappings_delta::response,
                               telegraf_other::response,
                               getPhysicalPorts::response,
                               getLogicalPorts::response,
@@ -1007,6 +1060,7 @@ using response = std::variant<std::tuple<>,
                               rib_save::response,
                               limit_summary::response,
                               getFwList::response,
+                              get_fw_states::response,
                               getFwLabels::response,
                               getSamples::response,
                               getAclConfig::response,
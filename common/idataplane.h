@@ -90,6 +90,21 @@ public:
 		return get<common::idp::requestType::getFWState, common::idp::getFWState::response>();
 	}
 
+	common::idp::get_fw_state_page::response get_fw_state_page(const common::idp::get_fw_state_page::request& request) const
+	{
+		return get<common::idp::requestType::get_fw_state_page, common::idp::get_fw_state_page::response>(request);
+	}
+
+	eResult state_export(const common::idp::state_export::request& request) const
+	{
+		return get<common::idp::requestType::state_export, eResult>(request);
+	}
+
+	eResult state_import(const common::idp::state_import::request& request) const
+	{
+		return get<common::idp::requestType::state_import, eResult>(request);
+	}
+
 	common::idp::getFWStateStats::response getFWStateStats() const
 	{
 		return get<common::idp::requestType::getFWStateStats, common::idp::getFWStateStats::response>();
@@ -82,6 +82,9 @@ enum class requestType : uint32_t
 	neighbor_stats,
 	memory_manager_update,
 	memory_manager_stats,
+	get_fw_state_page,
+	state_export,
+	state_import,
 	size, // size should always be at the bottom of the list, this enum allows us to find out the size of the enum list
 };
 
@@ -166,9 +169,11 @@ enum class requestType : uint32_t
 	serial_update,
 	nat46clat_update,
 	dump_tags_ids,
+	acl_meters,
 	tsc_state_update,
 	tscs_base_value_update,
-	update_host_config
+	update_host_config,
+	nat64stateless_lookup_update
 };
 
 namespace updateLogicalPort
@@ -266,6 +271,21 @@ using request = std::tuple<tNat64statelessTranslationId,
                            std::optional<std::tuple<uint16_t, uint16_t>>>; ///< ingressPort, egressPort
 }
 
+namespace nat64stateless_lookup_update
+{
+using ingress = std::tuple<tNat64statelessId,
+                           ipv6_address_t, ///< ipv6Address
+                           ipv6_address_t, ///< ipv6DestinationAddress, first 96 bits are used
+                           tNat64statelessTranslationId>;
+
+using egress = std::tuple<tNat64statelessId,
+                          ipv4_address_t, ///< ipv4Address
+                          tNat64statelessTranslationId>;
+
+using request = std::tuple<std::vector<ingress>,
+                           std::vector<egress>>;
+}
+
 namespace nat46clat_update
 {
 using request = std::tuple<nat46clat_id_t,
@@ -383,6 +403,12 @@ namespace dump_tags_ids
 using request = std::vector<std::string>;
 }
 
+namespace acl_meters
+{
+using request = std::vector<std::tuple<uint32_t, ///< rate
+                                       uint32_t>>; ///< burst
+}
+
 namespace route_lpm_update
 {
 using request = lpm::request;
@@ -516,7 +542,11 @@ namespace update_host_config
 {
 using request = std::tuple<common::ipv4_address_t, ///< host address ipv4
                            common::ipv6_address_t, ///< host address ipv6
-                           bool>; ///< hidden ip_address of host
+                           bool, ///< hidden ip_address of host
+                           uint32_t, ///< time exceeded rate
+                           uint32_t, ///< time exceeded burst
+                           uint8_t, ///< time exceeded ipv4 prefix
+                           uint8_t>; ///< time exceeded ipv6 prefix
 }
 
 using requestVariant = std::variant<std::tuple<>,
@@ -543,6 +573,7 @@ using requestVariant = std::variant<std::tuple<>,
                                     acl_total_table::request,
                                     acl_values::request,
                                     dump_tags_ids::request,
+                                    acl_meters::request,
                                     lpm::request,
                                     route_value_update::request,
                                     route_tunnel_value_update::request,
@@ -555,7 +586,8 @@ using requestVariant = std::variant<std::tuple<>,
                                     serial_update::request,
                                     nat46clat_update::request,
                                     tscs_base_value_update::request,
-                                    update_host_config::request>;
+                                    update_host_config::request,
+                                    nat64stateless_lookup_update::request>;
 
 using request = std::vector<std::tuple<requestType,
                                        requestVariant>>;
@@ -723,6 +755,32 @@ using response = std::map<
         value_t>;
 }
 
+namespace get_fw_state_page
+{
+using filter_t = std::tuple<std::optional<std::uint8_t>, ///< proto
+                            std::optional<ip_prefix_t>, ///< srcIP
+                            std::optional<ip_prefix_t>, ///< dstIP
+                            std::optional<std::uint16_t>, ///< srcPort
+                            std::optional<std::uint16_t>>; ///< dstPort
+
+using request = std::tuple<filter_t,
+                           std::optional<getFWState::key_t>, ///< cursor: page starts from this key
+                           std::uint32_t>; ///< limit
+
+using response = std::tuple<getFWState::response,
+                            std::optional<getFWState::key_t>>; ///< cursor of the next page, empty on the last page
+}
+
+namespace state_export
+{
+using request = std::string; ///< path to file of states
+}
+
+namespace state_import
+{
+using request = state_export::request;
+}
+
 namespace getFWStateStats
 {
 using response = fwstate::stats_t;
@@ -780,7 +838,12 @@ using response = std::map<uint16_t, ///< socketId
 
 namespace nat64stateful_state
 {
-using request = std::tuple<std::optional<uint32_t>>; ///< nat64stateful_id
+using cursor = std::tuple<tCoreId, ///< worker_gc core_id
+                          uint32_t>; ///< offset in wan state table
+
+using request = std::tuple<std::optional<uint32_t>, ///< nat64stateful_id
+                           std::optional<cursor>, ///< page starts from this position
+                           uint32_t>; ///< limit, page may exceed it by one table chunk
 
 using state = std::tuple<uint32_t, ///< nat64stateful_id
                          uint8_t, ///< proto
@@ -795,7 +858,10 @@ using state = std::tuple<uint32_t, ///< nat64stateful_id
                          std::optional<uint16_t>, ///< lan_last_seen
                          std::optional<uint16_t>>; ///< wan_last_seen
 
-using response = std::vector<state>;
+using states = std::vector<state>;
+
+using response = std::tuple<states,
+                            std::optional<cursor>>; ///< cursor of the next page, empty on the last page
 }
 
 namespace balancer_connection
@@ -1035,7 +1101,9 @@ using request = std::tuple<requestType,
                                         neighbor_insert::request,
                                         neighbor_remove::request,
                                         neighbor_update_interfaces::request,
-                                        memory_manager_update::request>>;
+                                        memory_manager_update::request,
+                                        get_fw_state_page::request,
+                                        state_export::request>>;
 
 using response = std::variant<std::tuple<>,
                               updateGlobalBase::response, ///< + others which have eResult as response
@@ -1068,5 +1136,6 @@ using response = std::variant<std::tuple<>,
                               get_shm_tsc_info::response,
                               neighbor_show::response,
                               neighbor_stats::response,
-                              memory_manager_stats::response>;
+                              memory_manager_stats::response,
+                              get_fw_state_page::response>;
 }
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace common::policer
+{
+
+/// Classes of traffic punted from a fast worker to the slow path.
+enum class class_e : uint8_t
+{
+	local, ///< slowWorker_kni_local: packets to local addresses (bgp, bfd, ssh, ...)
+	kni, ///< slowWorker_kni: packets forwarded to linux (nd, arp, multicast, ...)
+	slow, ///< everything else put to normal priority ring of slow worker
+	size
+};
+
+inline const char* class_to_string(const class_e class_id)
+{
+	switch (class_id)
+	{
+		case class_e::local:
+			return "local";
+		case class_e::kni:
+			return "kni";
+		case class_e::slow:
+			return "slow";
+		default:
+			return "unknown";
+	}
+}
+
+inline std::optional<class_e> class_from_string(const std::string& string)
+{
+	for (uint8_t class_i = 0;
+	     class_i < (uint8_t)class_e::size;
+	     class_i++)
+	{
+		if (string == class_to_string((class_e)class_i))
+		{
+			return (class_e)class_i;
+		}
+	}
+
+	return std::nullopt;
+}
+
+/// Rate in packets per second. Zero rate means unlimited.
+struct rate_t
+{
+	uint32_t rate{};
+	uint32_t burst{};
+};
+
+struct config_t
+{
+	uint32_t table_size{4096}; ///< buckets per worker, rounded up to power of 2
+	uint8_t ipv4_prefix{32};
+	uint8_t ipv6_prefix{64};
+
+	struct
+	{
+		rate_t aggregate; ///< per worker, all sources of the class
+		rate_t source; ///< per worker, per source prefix
+	} classes[(uint8_t)class_e::size];
+
+	[[nodiscard]] bool enabled() const
+	{
+		for (const auto& class_config : classes)
+		{
+			if (class_config.aggregate.rate || class_config.source.rate)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+};
+
+}
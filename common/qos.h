@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+
+#include "config.h"
+
+namespace common::qos
+{
+
+constexpr uint8_t dscp_size = 64;
+
+struct class_config_t
+{
+	uint8_t priority{}; ///< classes with lower value are served first, equal values share by weight
+	uint16_t weight{1}; ///< packets per round among classes of the same priority
+	uint32_t queue_size{512}; ///< mbufs, rounded up to power of 2
+};
+
+/// Egress scheduler of one physical port.
+struct port_config_t
+{
+	uint8_t classes_count{}; ///< zero means scheduler is disabled
+	uint64_t rate{}; ///< bytes per second per worker, zero means unshaped
+	uint32_t burst{}; ///< bytes
+	uint8_t dscp_to_class[dscp_size]{};
+	class_config_t classes[YANET_CONFIG_QOS_CLASSES_SIZE];
+
+	[[nodiscard]] bool enabled() const
+	{
+		return classes_count != 0;
+	}
+};
+
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <cstring>
 #include <thread>
 
 #include "result.h"
@@ -236,21 +238,108 @@ public:
 			                                         sdp_data.metadata_worker.start_counters));
 		}
 
-		for (size_t i = 0; i < counter_ids.size(); i++)
+		/// sum worker by worker, so each buffer is read in one pass
+		for (const auto& buffer : buffers)
 		{
-			auto counter_id = counter_ids[i];
-			if (counter_id >= YANET_CONFIG_COUNTERS_SIZE)
+			for (size_t i = 0; i < counter_ids.size(); i++)
 			{
-				continue;
+				auto counter_id = counter_ids[i];
+				if (counter_id >= YANET_CONFIG_COUNTERS_SIZE)
+				{
+					continue;
+				}
+
+				result[i] += buffer[counter_id];
 			}
+		}
+
+		return result;
+	}
+
+	/*
+	 * The function gets the sum of values from all workers for contiguous counter IDs
+	 * Params:
+	 * - sdp_data - the Data Plane In Shared Memory object contains data about connection to shared memory buffers
+	 * - counter_id - first counter ID
+	 * - result - aggregated values of counter IDs [counter_id, counter_id + result.size()),
+	 *   values out of YANET_CONFIG_COUNTERS_SIZE are zero
+	 */
+	static void GetCountersRange(const DataPlaneInSharedMemory& sdp_data,
+	                             const tCounterId counter_id,
+	                             std::vector<uint64_t>& result)
+	{
+		std::fill(result.begin(), result.end(), 0);
+		if (counter_id >= YANET_CONFIG_COUNTERS_SIZE)
+		{
+			return;
+		}
+
+		const size_t count = std::min(result.size(), (size_t)(YANET_CONFIG_COUNTERS_SIZE - counter_id));
+		for (const auto& iter : sdp_data.workers)
+		{
+			const auto* buffer = ShiftBuffer<const uint64_t*>(iter.second.buffer,
+			                                                  sdp_data.metadata_worker.start_counters) +
+			                     counter_id;
+			for (size_t i = 0; i < count; i++)
+			{
+				result[i] += buffer[i];
+			}
+		}
+	}
+
+	/*
+	 * The function works like the previous one, but it opens buffers in shared memory by itself. In case of
+	 *  an opening error, it calls exit().
+	 */
+	static std::vector<uint64_t> GetCounters(const std::vector<tCounterId>& counter_ids)
+	{
+		DataPlaneInSharedMemory sdp_data;
+		if (ReadSharedMemoryData(sdp_data, true) != eResult::success)
+		{
+			std::exit(1);
+		}
+		return GetCounters(sdp_data, counter_ids);
+	}
 
-			uint64_t counter = 0;
-			for (const auto& buffer : buffers)
+	/*
+	 * The function copies statistics of all workers and workers_gc from shared memory, the dataplane is not
+	 * requested and workers are not stopped
+	 * Params:
+	 * - sdp_data - the Data Plane In Shared Memory object contains data about connection to shared memory buffers,
+	 *   workers data must be opened
+	 * Return: Statistics snapshot
+	 */
+	static StatsSnapshot GetStatsSnapshot(const DataPlaneInSharedMemory& sdp_data)
+	{
+		StatsSnapshot result;
+
+		for (const auto& [core_id, worker_info] : sdp_data.workers)
+		{
+			auto& worker = result.workers[core_id];
+			const auto* buffer = ShiftBuffer<const uint64_t*>(worker_info.buffer,
+			                                                  sdp_data.metadata_worker.start_counters);
+			for (const auto& [name, index] : sdp_data.metadata_worker.counter_positions)
 			{
-				counter += buffer[counter_id];
+				worker.counters[name] = buffer[index];
 			}
 
-			result[i] = counter;
+			memcpy(worker.bursts.data(),
+			       ShiftBuffer<const uint64_t*>(worker_info.buffer, sdp_data.metadata_worker.start_bursts),
+			       sizeof(worker.bursts));
+			memcpy(worker.ports.data(),
+			       ShiftBuffer<const common::worker::stats::port*>(worker_info.buffer, sdp_data.metadata_worker.start_stats_ports),
+			       sizeof(worker.ports));
+		}
+
+		for (const auto& [core_id, worker_info] : sdp_data.workers_gc)
+		{
+			auto& worker_gc = result.workers_gc[core_id];
+			const auto* buffer = ShiftBuffer<const uint64_t*>(worker_info.buffer,
+			                                                  sdp_data.metadata_worker_gc.start_counters);
+			for (const auto& [name, index] : sdp_data.metadata_worker_gc.counter_positions)
+			{
+				worker_gc[name] = buffer[index];
+			}
 		}
 
 		return result;
@@ -260,14 +349,101 @@ public:
 	 * The function works like the previous one, but it opens buffers in shared memory by itself. In case of
 	 *  an opening error, it calls exit().
 	 */
-	static std::vector<uint64_t> GetCounters(const std::vector<tCounterId>& counter_ids)
+	static StatsSnapshot GetStatsSnapshot()
 	{
 		DataPlaneInSharedMemory sdp_data;
 		if (ReadSharedMemoryData(sdp_data, true) != eResult::success)
 		{
 			std::exit(1);
 		}
-		return GetCounters(sdp_data, counter_ids);
+		return GetStatsSnapshot(sdp_data);
+	}
+
+	/*
+	 * The function copies the neighbor table published by the dataplane in the TABLES section.
+	 * The copy is consistent: it is retried while the dataplane updates the table.
+	 * Params:
+	 * sdp_data - the DataPlaneInSharedMemory object with the opened main file
+	 * response - filled with the same values as the neighbor_show request of the dataplane
+	 * Returns: result::success if successful, errorInitSharedMemory if the layout version is unknown
+	 *          or the table is updated during all attempts
+	 */
+	[[nodiscard]] static eResult GetNeighborTable(const DataPlaneInSharedMemory& sdp_data,
+	                                              common::idp::neighbor_show::response& response)
+	{
+		const TablesHeader* header = sdp_data.Tables();
+		if (header->version != TablesHeader::layout_version ||
+		    header->entry_size != sizeof(NeighborEntry) ||
+		    DataPlaneInSharedMemory::size_tables_header + header->neighbor_capacity * sizeof(NeighborEntry) > sdp_data.size_tables_section)
+		{
+			YANET_LOG_ERROR("unsupported layout of section TABLES, version: %lu\n", header->version);
+			return eResult::errorInitSharedMemory;
+		}
+
+		std::vector<NeighborEntry> entries;
+		for (int number_of_attempts = 0;
+		     number_of_attempts < SHARED_MEMORY_REREAD_MAXIMUM_ATTEMPTS;
+		     number_of_attempts++)
+		{
+			uint64_t generation = header->generation.load(std::memory_order_acquire);
+			if (generation & 1)
+			{
+				std::this_thread::sleep_for(std::chrono::microseconds{SHARED_MEMORY_REREAD_TIMEOUT_MICROSECONDS});
+				continue;
+			}
+
+			uint64_t count = std::min(header->neighbor_count, header->neighbor_capacity);
+			uint64_t timestamp = header->timestamp;
+			entries.resize(count);
+			std::memcpy(entries.data(), sdp_data.NeighborEntries(), count * sizeof(NeighborEntry));
+
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (header->generation.load(std::memory_order_relaxed) != generation)
+			{
+				continue;
+			}
+
+			response.clear();
+			for (const auto& entry : entries)
+			{
+				std::optional<uint32_t> last_update;
+				if (!(entry.flags & NeighborEntry::flag_is_static))
+				{
+					last_update = timestamp - entry.last_update_timestamp;
+				}
+
+				response.emplace_back(std::string(entry.route_name, strnlen(entry.route_name, sizeof(entry.route_name))),
+				                      std::string(entry.interface_name, strnlen(entry.interface_name, sizeof(entry.interface_name))),
+				                      common::ip_address_t(entry.flags & NeighborEntry::flag_is_ipv6 ? 6 : 4, entry.address),
+				                      common::mac_address_t(entry.mac_address),
+				                      last_update);
+			}
+
+			return eResult::success;
+		}
+
+		YANET_LOG_ERROR("neighbor table was updated during %d attempts to read\n", SHARED_MEMORY_REREAD_MAXIMUM_ATTEMPTS);
+		return eResult::errorInitSharedMemory;
+	}
+
+	/*
+	 * The function works like the previous one, but it opens buffers in shared memory by itself. In case of
+	 *  an error, it calls exit().
+	 */
+	static common::idp::neighbor_show::response GetNeighborTable()
+	{
+		DataPlaneInSharedMemory sdp_data;
+		if (ReadSharedMemoryData(sdp_data, false) != eResult::success)
+		{
+			std::exit(1);
+		}
+
+		common::idp::neighbor_show::response response;
+		if (GetNeighborTable(sdp_data, response) != eResult::success)
+		{
+			std::exit(1);
+		}
+		return response;
 	}
 
 private:
@@ -395,6 +571,18 @@ private:
 			}
 		}
 
+		// TABLES
+		{
+			sdp_data.start_tables_section = ReadValue(buffer, 6);
+			sdp_data.size_tables_section = ReadValue(buffer, 7);
+			if ((sdp_data.start_tables_section + sdp_data.size_tables_section > size) ||
+			    (sdp_data.size_tables_section < DataPlaneInSharedMemory::size_tables_header))
+			{
+				message = "Bad postion info section TABLES";
+				return eResultRead::need_reread;
+			}
+		}
+
 		return eResultRead::ok;
 	}
 
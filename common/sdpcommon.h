@@ -1,6 +1,8 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <numa.h>
 #include <sys/mman.h>
 
@@ -38,12 +40,14 @@ The file contains the following sections:
 - WORKERS
 - WORKERS_METADATA
 - BUS
+- TABLES
 
 HEADER - 1024 bytes in size (DataPlaneInSharedMemory::size_header)
 Contains the beginning and the size of the remaining sections, 2 numbers each:
 - 0,1 - WORKERS
 - 2,3 - WORKERS_MET
 - 4,5 - BUS
+- 6,7 - TABLES
   The remaining values are reserved
 
 WORKERS
@@ -69,6 +73,18 @@ WORKERS_METADATA
 BUS
 Contains a buffer used by cBus counters
 
+TABLES
+Read-only copies of dataplane tables for local tools. Unlike the rest of the file,
+values are stored in host byte order.
+  At the beginning, TablesHeader (64 bytes) is written:
+    version - TablesHeader::layout_version, readers must reject other values
+    entry_size - sizeof(NeighborEntry)
+    neighbor_capacity - maximum number of neighbor entries
+    generation - incremented before and after each update, odd while the table is being written
+    neighbor_count - number of valid neighbor entries
+    timestamp - dataplane time of the last update, seconds
+  Starting from 64 bytes, there are neighbor_capacity entries NeighborEntry
+
 ---------------------------------------
 2 - Socket data file
 The file consists of several blocks, each block corresponds to a worker or worker_gc.
@@ -163,9 +179,61 @@ struct WorkerInSharedMemory
 	}
 };
 
+/// Statistics of one worker copied from shared memory.
+struct WorkerStatsSnapshot
+{
+	std::map<std::string, uint64_t> counters; ///< named counters and stats fields
+	std::array<uint64_t, CONFIG_YADECAP_MBUFS_BURST_SIZE + 1> bursts;
+	std::array<common::worker::stats::port, CONFIG_YADECAP_PORTS_SIZE> ports;
+};
+
+/// Statistics of all workers and workers_gc copied from shared memory.
+///
+/// Values are read while workers keep running, each value is consistent
+/// but the snapshot as a whole is not taken at one moment.
+struct StatsSnapshot
+{
+	std::map<tCoreId, WorkerStatsSnapshot> workers;
+	std::map<tCoreId, std::map<std::string, uint64_t>> workers_gc;
+};
+
+/// Neighbor table entry of the TABLES section.
+struct NeighborEntry
+{
+	static constexpr uint16_t flag_is_ipv6 = 1 << 0;
+	static constexpr uint16_t flag_is_static = 1 << 1;
+
+	char route_name[48];
+	char interface_name[48];
+	uint8_t address[16]; ///< ipv4 address is stored in the last 4 bytes
+	uint8_t mac_address[6];
+	uint16_t flags;
+	uint32_t last_update_timestamp;
+	uint32_t reserved;
+};
+
+static_assert(sizeof(NeighborEntry) == 128, "invalid size");
+
+/// Header of the TABLES section, updated by the dataplane as a seqlock.
+struct TablesHeader
+{
+	static constexpr uint64_t layout_version = 1;
+
+	uint64_t version;
+	uint64_t entry_size;
+	uint64_t neighbor_capacity;
+	std::atomic<uint64_t> generation;
+	uint64_t neighbor_count;
+	uint64_t timestamp;
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "generation must be lock free in shared memory");
+static_assert(sizeof(TablesHeader) <= 64, "invalid size");
+
 struct DataPlaneInSharedMemory
 {
 	static constexpr uint64_t size_header = 1024;
+	static constexpr uint64_t size_tables_header = 64;
 
 	using workers_info = std::map<tCoreId, WorkerInSharedMemory>;
 
@@ -178,10 +246,13 @@ struct DataPlaneInSharedMemory
 	uint64_t size_workers_section;
 	uint64_t size_workers_metadata_section;
 	uint64_t size_bus_section;
+	uint64_t size_tables_section;
+	uint64_t neighbor_capacity = 0;
 
 	uint64_t size_dataplane_buffer;
 	void* dataplane_data = nullptr;
 	uint64_t start_bus_section;
+	uint64_t start_tables_section;
 
 	void UnmapBuffers(uint64_t size)
 	{
@@ -200,6 +271,8 @@ struct DataPlaneInSharedMemory
 		return other.metadata_worker == metadata_worker &&
 		       other.metadata_worker_gc == metadata_worker_gc &&
 		       other.start_bus_section == start_bus_section &&
+		       other.start_tables_section == start_tables_section &&
+		       other.size_tables_section == size_tables_section &&
 		       MapsEqual(other.workers, workers) &&
 		       MapsEqual(other.workers_gc, workers_gc);
 	}
@@ -209,7 +282,8 @@ struct DataPlaneInSharedMemory
 		size_workers_section = Allign64((2 + 3 * (workers.size() + workers_gc.size())) * sizeof(uint64_t));
 		size_workers_metadata_section = 128 * (1 + metadata_worker.counter_positions.size() + metadata_worker_gc.counter_positions.size());
 		size_bus_section = Allign64(size_bus_section);
-		size_dataplane_buffer = size_header + size_workers_section + size_workers_metadata_section + size_bus_section;
+		size_tables_section = size_tables_header + neighbor_capacity * sizeof(NeighborEntry);
+		size_dataplane_buffer = size_header + size_workers_section + size_workers_metadata_section + size_bus_section + size_tables_section;
 	}
 
 	static uint64_t Allign64(uint64_t value)
@@ -226,6 +300,16 @@ struct DataPlaneInSharedMemory
 		auto* durations = ShiftBuffer<uint64_t*>(dataplane_data, start_bus_section + (count_requests + count_errors) * sizeof(uint64_t));
 		return {requests, errors, durations};
 	}
+
+	[[nodiscard]] TablesHeader* Tables() const
+	{
+		return ShiftBuffer<TablesHeader*>(dataplane_data, start_tables_section);
+	}
+
+	[[nodiscard]] NeighborEntry* NeighborEntries() const
+	{
+		return ShiftBuffer<NeighborEntry*>(dataplane_data, start_tables_section + size_tables_header);
+	}
 };
 
 } // namespace common::sdp
@@ -84,10 +84,12 @@ public:
 	 * - use_huge_tlb - if true, it will use MAP_HUGETLB
 	 * - socket_id - id of the numa node on which one want to allocate a buffer,
 	 *               if std::nullptr - it will be selected automatically by the system
+	 * - populate - if false, pages are not touched and are backed by memory on first write,
+	 *              huge pages are reserved for the whole buffer at creation anyway
 	 * Return value:
 	 * void* - address of the allocated buffer, nullptr if an error occurred
 	 */
-	static void* CreateBufferFile(std::string filename, size_t size, bool use_huge_tlb, std::optional<tSocketId> socket_id)
+	static void* CreateBufferFile(std::string filename, size_t size, bool use_huge_tlb, std::optional<tSocketId> socket_id, bool populate = true)
 	{
 		// Open or creare shared memory file
 		int flags_open = O_RDWR | O_CREAT;
@@ -98,8 +100,12 @@ public:
 			return nullptr;
 		}
 
-		// Truncate - set file size
-		int res_trunc = ftruncate(fd, size);
+		// Truncate - drop contents of previous run and set file size
+		int res_trunc = ftruncate(fd, 0);
+		if (res_trunc == 0)
+		{
+			res_trunc = ftruncate(fd, size);
+		}
 		if (res_trunc < 0)
 		{
 			YANET_LOG_ERROR("filename=%s, ftruncate(%d, %lu): %s\n", filename.c_str(), fd, size, strerror(errno));
@@ -126,8 +132,15 @@ public:
 		               size,
 		               filename.c_str());
 
-		// Zero memory
-		memset(addr, 0, size);
+		// Zero memory, new file is already zeroed
+		if (populate)
+		{
+			memset(addr, 0, size);
+		}
+		else
+		{
+			BindMemoryPolicy(addr, size, socket_id);
+		}
 
 		// Restore memory policy if necessary
 		RestoreMemoryPolicy(socket_id, oldmask, oldpolicy);
@@ -149,10 +162,12 @@ public:
 	 * - use_huge_tlb - if true, it will use MAP_HUGETLB
 	 * - socket_id - id of the numa node on which one want to allocate a buffer,
 	 *               if std::nullptr - it will be selected automatically by the system
+	 * - populate - if false, pages are not touched and are backed by memory on first write,
+	 *              huge pages are reserved for the whole buffer at creation anyway
 	 * Return value:
 	 * void* - address of the allocated buffer, nullptr if an error occurred
 	 */
-	static void* CreateBufferKey(key_t key, size_t size, bool use_huge_tlb, std::optional<tSocketId> socket_id)
+	static void* CreateBufferKey(key_t key, size_t size, bool use_huge_tlb, std::optional<tSocketId> socket_id, bool populate = true)
 	{
 		// Delete old segment
 		int shmid = shmget(key, 0, 0);
@@ -187,8 +202,15 @@ public:
 		               size,
 		               key);
 
-		// Zero memory
-		memset(addr, 0, size);
+		// Zero memory, new segment is already zeroed
+		if (populate)
+		{
+			memset(addr, 0, size);
+		}
+		else
+		{
+			BindMemoryPolicy(addr, size, socket_id);
+		}
 
 		// Restore memory policy if necessary
 		RestoreMemoryPolicy(socket_id, oldmask, oldpolicy);
@@ -331,6 +353,25 @@ private:
 		}
 	}
 
+	/*
+	 * Binds preferred numa node to the buffer, so pages touched later by any thread are allocated on it
+	 */
+	static void BindMemoryPolicy(void* addr, size_t size, std::optional<tSocketId> socket_id)
+	{
+		if (!socket_id.has_value())
+		{
+			return;
+		}
+
+		struct bitmask* mask = numa_allocate_nodemask();
+		numa_bitmask_setbit(mask, *socket_id);
+		if (mbind(addr, size, MPOL_PREFERRED, mask->maskp, mask->size + 1, 0) < 0)
+		{
+			YANET_LOG_WARNING("mbind(%p, %lu, %d): %s\n", addr, size, *socket_id, strerror(errno));
+		}
+		numa_free_nodemask(mask);
+	}
+
 	static int GetFlags(int start_value, bool use_huge_tlb, int flag_of_huge_tlb)
 	{
 		int flags = start_value;
@@ -1924,6 +1924,10 @@ struct common
 	uint64_t logs_packets;
 	uint64_t logs_drops;
 	uint64_t ttl_exceeded;
+	uint64_t ttl_exceeded_limited; ///< time exceeded errors not generated by rate limit
+	uint64_t idle_iterations; ///< iterations without received packets
+	uint64_t idle_sleep_us;
+	uint64_t repeat_packets; ///< packets of repeat nexthops recirculated by worker
 };
 
 struct port
@@ -1987,6 +1991,13 @@ enum class static_counter_type : uint32_t
 	acl_egress_v4_broken_packet,
 	acl_egress_v6_broken_packet,
 	slow_worker_normal_priority_rate_limit_exceeded,
+	policer_local_class_drops,
+	policer_local_source_drops,
+	policer_kni_class_drops,
+	policer_kni_source_drops,
+	policer_slow_class_drops,
+	policer_slow_source_drops,
+	policer_evictions,
 	size
 };
 
@@ -2183,6 +2194,10 @@ union tFlowData
 static_assert(CONFIG_YADECAP_NAT64STATELESSES_SIZE <= 0xFF);
 static_assert(CONFIG_YADECAP_NAT64STATELESS_TRANSLATIONS_SIZE <= 0xFFFFFF);
 
+/// translationId of nat64stateless flows, which translation is found by dataplane lookup tables
+constexpr tNat64statelessTranslationId nat64stateless_translation_lookup = 0xFFFFFF;
+static_assert(CONFIG_YADECAP_NAT64STATELESS_TRANSLATIONS_SIZE <= nat64stateless_translation_lookup);
+
 using flow_data_t = tFlowData;
 
 class tFlow
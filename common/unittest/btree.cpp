@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include "../btree.h"
+
+namespace
+{
+using common::ip_address_t;
+using common::ip_prefix_t;
+
+using btree = common::btree<ip_address_t, uint32_t>;
+
+std::vector<std::tuple<std::string, uint32_t>> lookup_deep(const btree& tree,
+                                                           const std::string& prefix)
+{
+	std::vector<std::tuple<std::string, uint32_t>> result;
+	tree.lookup_deep(ip_prefix_t(prefix), [&result](const ip_prefix_t& prefix, const uint32_t& value) {
+		result.emplace_back(prefix.toString(), value);
+	});
+	return result;
+}
+
+TEST(BTree, Lookup)
+{
+	btree tree;
+	tree.insert(ip_prefix_t("0.0.0.0/0"), 1);
+	tree.insert(ip_prefix_t("10.0.0.0/8"), 2);
+	tree.insert(ip_prefix_t("10.1.0.0/16"), 3);
+	tree.insert(ip_prefix_t("10.1.2.0/24"), 4);
+	tree.insert(ip_prefix_t("2000::/3"), 5);
+
+	EXPECT_EQ(std::make_tuple(3u, 16u), *tree.lookup(ip_address_t("10.1.3.1")));
+	EXPECT_EQ(std::make_tuple(4u, 24u), *tree.lookup(ip_address_t("10.1.2.1")));
+	EXPECT_EQ(std::make_tuple(1u, 0u), *tree.lookup(ip_address_t("11.0.0.1")));
+	EXPECT_EQ(std::make_tuple(5u, 3u), *tree.lookup(ip_address_t("2a02::1")));
+	EXPECT_FALSE(tree.lookup(ip_address_t("fe80::1")));
+
+	EXPECT_EQ(3u, *tree.get(ip_prefix_t("10.1.0.0/16")));
+	EXPECT_FALSE(tree.get(ip_prefix_t("10.1.0.0/17")));
+
+	std::vector<uint32_t> values;
+	tree.lookup_all(ip_prefix_t("10.1.2.0/24"), [&values](const uint32_t& value, const uint32_t mask) {
+		GCC_BUG_UNUSED(mask);
+		values.emplace_back(value);
+	});
+	EXPECT_EQ((std::vector<uint32_t>{1, 2, 3, 4}), values);
+
+	tree.remove(ip_prefix_t("10.1.0.0/16"));
+	EXPECT_EQ(std::make_tuple(2u, 8u), *tree.lookup(ip_address_t("10.1.3.1")));
+	EXPECT_EQ(std::make_tuple(4u, 24u), *tree.lookup(ip_address_t("10.1.2.1")));
+}
+
+TEST(BTree, LookupDeep)
+{
+	btree tree;
+	tree.insert(ip_prefix_t("10.0.0.0/8"), 1);
+	tree.insert(ip_prefix_t("10.1.0.0/16"), 2);
+	tree.insert(ip_prefix_t("10.1.128.0/17"), 3);
+	tree.insert(ip_prefix_t("10.2.0.0/16"), 4);
+
+	/// covering prefix first, then more specifics
+	EXPECT_EQ((std::vector<std::tuple<std::string, uint32_t>>{{"10.1.0.0/15", 1},
+	                                                          {"10.1.0.0/16", 2},
+	                                                          {"10.1.128.0/17", 3}}),
+	          lookup_deep(tree, "10.1.0.0/15"));
+
+	EXPECT_EQ((std::vector<std::tuple<std::string, uint32_t>>{{"10.1.0.0/16", 2},
+	                                                          {"10.1.128.0/17", 3}}),
+	          lookup_deep(tree, "10.1.0.0/16"));
+
+	EXPECT_EQ((std::vector<std::tuple<std::string, uint32_t>>{{"10.3.0.0/16", 1}}),
+	          lookup_deep(tree, "10.3.0.0/16"));
+
+	EXPECT_TRUE(lookup_deep(tree, "11.0.0.0/8").empty());
+}
+
+TEST(BTree, Compression)
+{
+	common::btree<ip_address_t, std::tuple<>> tree;
+	tree.insert(ip_prefix_t("10.0.0.0/24"), {});
+	tree.insert(ip_prefix_t("10.0.1.0/24"), {});
+	tree.insert(ip_prefix_t("192.168.0.0/16"), {});
+	tree.insert(ip_prefix_t("192.168.1.0/24"), {});
+
+	/// two branches and four prefixes
+	EXPECT_EQ(6u, tree.nodes_size());
+	EXPECT_EQ((std::vector<ip_prefix_t>{ip_prefix_t("10.0.0.0/24"),
+	                                    ip_prefix_t("10.0.1.0/24"),
+	                                    ip_prefix_t("192.168.0.0/16")}),
+	          tree.get_all_top());
+
+	tree.remove(ip_prefix_t("10.0.0.0/24"));
+	tree.remove(ip_prefix_t("192.168.0.0/16"));
+	EXPECT_EQ(3u, tree.nodes_size());
+	EXPECT_EQ((std::vector<ip_prefix_t>{ip_prefix_t("10.0.1.0/24"),
+	                                    ip_prefix_t("192.168.1.0/24")}),
+	          tree.get_all_top());
+
+	tree.clear();
+	EXPECT_TRUE(tree.get_all_top().empty());
+}
+
+} // namespace
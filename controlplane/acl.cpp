@@ -322,6 +322,7 @@ struct firewall_rules_t
 					case ipfw::rule_action_t::CHECKSTATE:
 					case ipfw::rule_action_t::STATETIMEOUT:
 					case ipfw::rule_action_t::HITCOUNT:
+					case ipfw::rule_action_t::RATELIMIT:
 					{
 						// handle only meaning rules
 						auto& ruleref = yanet_rules.emplace_back(rulep, configp);
@@ -899,7 +900,8 @@ std::vector<rule_t> unwind_used_rules(const std::map<std::string, controlplane::
 					        if constexpr (std::is_same_v<T, common::globalBase::tFlow> ||
 					                      std::is_same_v<T, common::acl::check_state_t> ||
 					                      std::is_same_v<T, common::acl::dump_t> ||
-					                      std::is_same_v<T, common::acl::hit_count_t>)
+					                      std::is_same_v<T, common::acl::hit_count_t> ||
+					                      std::is_same_v<T, common::acl::rate_limit_t>)
 					        {
 						        action.counter_id = get_or_create_counter_id(rule.ids, ids_map_map, result.ids_map, ids_overflow);
 					        }
@@ -937,6 +939,28 @@ std::vector<rule_t> unwind_used_rules(const std::map<std::string, controlplane::
 							        }
 						        }
 					        }
+					        else if constexpr (std::is_same_v<T, common::acl::rate_limit_t>)
+					        {
+						        auto it = result.meter_to_id.find(action.meter);
+						        if (it == result.meter_to_id.end())
+						        {
+							        if (action.rate == 0 ||
+							            result.acl_meters.size() >= YANET_CONFIG_ACL_METERS_SIZE)
+							        {
+								        YANET_LOG_WARNING("rate-limit: invalid rate or too many meters, skip meter '%s'\n", action.meter.data());
+								        remove_rule = true;
+								        return;
+							        }
+
+							        result.acl_meters.emplace_back(action.rate, action.burst);
+							        it = result.meter_to_id.emplace_hint(it, action.meter, result.acl_meters.size() - 1);
+						        }
+						        else if (result.acl_meters[it->second] != std::make_tuple(action.rate, action.burst))
+						        {
+							        throw std::runtime_error("rate-limit: meter '" + action.meter + "' is redefined with other rate or burst");
+						        }
+						        action.meter_id = it->second;
+					        }
 					        // No specific logic needed for the rest of the actions like state_timeout_t
 					        // Most notably, we don't need counter_id for them since they are not actually presented as an action
 					        // that packet "goes through". In case of state_timeout_t, its optimized so the resulting timeout
@@ -38,6 +38,9 @@ struct result_t
 
 	std::vector<std::string> dump_id_to_tag;
 	std::map<std::string, uint32_t> tag_to_dump_id;
+
+	common::idp::updateGlobalBase::acl_meters::request acl_meters;
+	std::map<std::string, uint32_t> meter_to_id;
 };
 
 iface_map_t ifaceMapping(std::map<std::string, controlplane::base::logical_port_t> logicalPorts,
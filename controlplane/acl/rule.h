@@ -1033,7 +1033,7 @@ const int64_t DISPATCHER = -1;
 // sense.
 //
 // Additionally, we might have another variant for representing rules that are suitable for execution in the dataplane.
-using rule_action = std::variant<int64_t, common::globalBase::tFlow, common::acl::dump_t, common::acl::check_state_t, common::acl::state_timeout_t, common::acl::hit_count_t>;
+using rule_action = std::variant<int64_t, common::globalBase::tFlow, common::acl::dump_t, common::acl::check_state_t, common::acl::state_timeout_t, common::acl::hit_count_t, common::acl::rate_limit_t>;
 
 struct rule_t
 {
@@ -1107,6 +1107,12 @@ public:
 			case ipfw::rule_action_t::HITCOUNT:
 				action = common::acl::hit_count_t(std::get<std::string>(rulep->action_arg));
 				break;
+			case ipfw::rule_action_t::RATELIMIT:
+			{
+				const auto& [meter, rate, burst] = std::get<ipfw::rule_t::ratelimit_arg_t>(rulep->action_arg);
+				action = common::acl::rate_limit_t(meter, rate, burst);
+				break;
+			}
 			default:
 				YANET_LOG_WARNING("unexpected rule action in rule '%s'\n", rulep->text.data());
 				return;
@@ -1194,6 +1200,10 @@ public:
 			{
 				text = "hitcount(" + rule.id + ")";
 			}
+			else if constexpr (std::is_same_v<T, common::acl::rate_limit_t>)
+			{
+				text = "rate-limit(" + rule.meter + ", " + std::to_string(rule.rate) + ", " + std::to_string(rule.burst) + ")";
+			}
 			else if constexpr (std::is_same_v<T, int64_t>)
 			{
 				switch (rule)
@@ -1398,6 +1408,10 @@ struct hash<acl::rule_t>
 			{
 				action_value = std::hash<std::string>{}(action.id);
 			}
+			else if constexpr (std::is_same_v<T, common::acl::rate_limit_t>)
+			{
+				action_value = std::hash<std::string>{}(action.meter);
+			}
 		},
 		           r.action);
 
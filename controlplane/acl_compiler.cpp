@@ -1,3 +1,6 @@
+#include <optional>
+#include <thread>
+
 #include "acl_compiler.h"
 #include "acl_filter.h"
 #include "acl_value.h"
@@ -7,6 +10,7 @@ using namespace acl;
 compiler_t::compiler_t() :
         transport_layers_size_max(1),
         transport_layers_shift(0),
+        network_parallel(true),
         network_ipv4_source(this),
         network_ipv4_destination(this),
         network_ipv6_source(this),
@@ -296,6 +300,10 @@ void compiler_t::collect(const std::vector<rule_t>& unwind_rules)
 			{
 				rule.value_filter_id = value.collect_initial_rule(*hit_count);
 			}
+			else if (auto rate_limit = std::get_if<common::acl::rate_limit_t>(&unwind_rule.action))
+			{
+				rule.value_filter_id = value.collect_initial_rule(*rate_limit);
+			}
 		}
 
 		/// terminating
@@ -342,15 +350,54 @@ void compiler_t::collect(const std::vector<rule_t>& unwind_rules)
 
 void compiler_t::network_compile()
 {
-	network_ipv4_source.prepare();
-	network_ipv4_destination.prepare();
-	network_ipv6_source.prepare();
-	network_ipv6_destination.prepare();
+	/// trees are independent until remap, so each one is built by its own thread.
+	/// every tree is built by the same serial code, chunks are identical to single thread build
+	std::vector<std::thread> threads;
+	threads.reserve(4);
+	std::vector<std::optional<std::exception_ptr>> exceptions(4);
+
+	auto network_thread = [&](auto& network, auto& exception) {
+		auto build = [&network, &exception]() {
+			try
+			{
+				network.prepare();
+				network.compile();
+				network.populate();
+			}
+			catch (...)
+			{
+				YANET_LOG_ERROR("exception in thread\n");
+				exception = std::current_exception();
+			}
+		};
 
-	network_ipv4_source.compile();
-	network_ipv4_destination.compile();
-	network_ipv6_source.compile();
-	network_ipv6_destination.compile();
+		if (network_parallel)
+		{
+			threads.emplace_back(build);
+		}
+		else
+		{
+			build();
+		}
+	};
+
+	network_thread(network_ipv4_source, exceptions[0]);
+	network_thread(network_ipv4_destination, exceptions[1]);
+	network_thread(network_ipv6_source, exceptions[2]);
+	network_thread(network_ipv6_destination, exceptions[3]);
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	for (const auto& exception : exceptions)
+	{
+		if (exception)
+		{
+			std::rethrow_exception(*exception);
+		}
+	}
 
 	YANET_LOG_INFO("acl::compile: extended_chunks: %lu, %lu, %lu, %lu\n",
 	               network_ipv4_source.tree.chunks.size(),
@@ -358,11 +405,6 @@ void compiler_t::network_compile()
 	               network_ipv6_source.tree.chunks.size(),
 	               network_ipv6_destination.tree.chunks.size());
 
-	network_ipv4_source.populate();
-	network_ipv4_destination.populate();
-	network_ipv6_source.populate();
-	network_ipv6_destination.populate();
-
 	YANET_LOG_INFO("acl::compile: group_ids: %lu, %lu, %lu, %lu\n",
 	               network_ipv4_source.reverse_map.size(),
 	               network_ipv4_destination.reverse_map.size(),
@@ -390,6 +432,7 @@ void compiler_t::network_table_compile()
 
 	network_table.compile();
 	network_table.populate();
+	network_table.compress();
 
 #ifdef ACL_DEBUG
 	size_t group_ids = 0;
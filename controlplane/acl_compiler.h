@@ -70,6 +70,9 @@ public:
 	unsigned int transport_layers_size_max;
 	unsigned int transport_layers_shift;
 
+	/// build network trees in parallel threads. result does not depend on it
+	bool network_parallel;
+
 	std::vector<compiler::rule_t> rules;
 
 	compiler::network_t<uint32_t> network_ipv4_source;
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <unordered_map>
+
 #include "acl_network_table.h"
 #include "acl_compiler.h"
 
@@ -134,6 +137,149 @@ void network_table_t::populate()
 	}
 }
 
+/// assigns ids to unique vectors in order of first appearance: remap[i] is id of vector i,
+/// firsts[id] is the first vector with this id. vectors are compared only when hashes are equal
+template<typename equal_T>
+static void unique(const std::vector<size_t>& hashes,
+                   const equal_T& equal,
+                   std::vector<tAclGroupId>& remap,
+                   std::vector<uint32_t>& firsts)
+{
+	std::unordered_multimap<size_t, tAclGroupId> ids;
+	ids.reserve(hashes.size());
+
+	for (uint32_t i = 0;
+	     i < hashes.size();
+	     i++)
+	{
+		auto [it, end] = ids.equal_range(hashes[i]);
+		while (it != end &&
+		       !equal(firsts[it->second], i))
+		{
+			++it;
+		}
+
+		if (it != end)
+		{
+			remap[i] = it->second;
+			continue;
+		}
+
+		remap[i] = firsts.size();
+		ids.emplace(hashes[i], firsts.size());
+		firsts.emplace_back(i);
+	}
+}
+
+/// merges equal rows and equal columns of table.
+/// source and destination group ids are remapped in network trees, so dataplane
+/// looks up smaller table without any indirection. row and column 0 are kept
+/// in place, they are values of not found prefixes.
+void network_table_t::compress()
+{
+	if (table.empty())
+	{
+		return;
+	}
+
+	const uint32_t height = table.sizes()[0];
+	const uint32_t columns = compiler->destination_group_id;
+	const auto& values = table.values();
+
+	std::vector<tAclGroupId> remap_source_group_ids(height, 0);
+	std::vector<uint32_t> rows; ///< first source group id of each unique row
+	{
+		std::vector<size_t> hashes(height, 0);
+		for (uint32_t row = 0;
+		     row < height;
+		     row++)
+		{
+			for (uint32_t column = 0;
+			     column < columns;
+			     column++)
+			{
+				common::hash_combine(hashes[row], values[row * width + column]);
+			}
+		}
+
+		auto row_equal = [&](const uint32_t a, const uint32_t b) {
+			return std::equal(values.begin() + a * width,
+			                  values.begin() + a * width + columns,
+			                  values.begin() + b * width);
+		};
+
+		unique(hashes, row_equal, remap_source_group_ids, rows);
+	}
+
+	std::vector<tAclGroupId> remap_destination_group_ids(columns, 0);
+	std::vector<uint32_t> columns_unique; ///< first destination group id of each unique column
+	{
+		/// rows are walked in memory order, every column is hashed once
+		std::vector<size_t> hashes(columns, 0);
+		for (const auto row : rows)
+		{
+			for (uint32_t column = 0;
+			     column < columns;
+			     column++)
+			{
+				common::hash_combine(hashes[column], values[row * width + column]);
+			}
+		}
+
+		auto column_equal = [&](const uint32_t a, const uint32_t b) {
+			for (const auto row : rows)
+			{
+				if (values[row * width + a] != values[row * width + b])
+				{
+					return false;
+				}
+			}
+			return true;
+		};
+
+		unique(hashes, column_equal, remap_destination_group_ids, columns_unique);
+	}
+
+	uint32_t next_width = 1;
+	while (next_width < columns_unique.size())
+	{
+		next_width <<= 1;
+	}
+
+	NDArray<tAclGroupId, dimension> next_table;
+	next_table.prepare(rows.size(), next_width);
+	for (uint32_t row = 0;
+	     row < rows.size();
+	     row++)
+	{
+		for (uint32_t column = 0;
+		     column < columns_unique.size();
+		     column++)
+		{
+			next_table(row, column) = values[rows[row] * width + columns_unique[column]];
+		}
+	}
+
+	YANET_LOG_INFO("acl::compile: network_table compress: %u x %u -> %lu x %u, size: %lu -> %lu\n",
+	               height,
+	               width,
+	               rows.size(),
+	               next_width,
+	               table.size(),
+	               next_table.size());
+
+	table = std::move(next_table);
+	width = next_width;
+
+	compiler->network_ipv4_source.tree.remap(remap_source_group_ids);
+	compiler->network_ipv6_source.tree.remap(remap_source_group_ids);
+	compiler->network_ipv4_destination.tree.remap(remap_destination_group_ids);
+	compiler->network_ipv6_destination.tree.remap(remap_destination_group_ids);
+
+	compiler->source_group_id = rows.size();
+	compiler->destination_group_id = columns_unique.size();
+}
+
 void network_table_t::table_insert(const DimensionArray& keys)
 {
 	auto& value = table(keys);
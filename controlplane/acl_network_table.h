@@ -27,6 +27,7 @@ public:
 	void prepare(const uint32_t height, const uint32_t width);
 	void compile();
 	void populate();
+	void compress();
 	void remap();
 
 public:
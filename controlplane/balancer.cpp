@@ -576,8 +576,6 @@ common::icp::balancer_real_find::response balancer_t::balancer_real_find(const c
 	common::icp::balancer_real_find::response reals = generations_services.current().reals;
 	generations_services.current_unlock();
 
-	const auto counters = real_counters.get_counters(); ///< @todo: filter
-
 	for (auto& [module, balancer] : reals)
 	{
 		const auto& [module_id, module_name] = module;
@@ -618,8 +616,12 @@ common::icp::balancer_real_find::response balancer_t::balancer_real_find(const c
 			GCC_BUG_UNUSED(version);
 
 			std::vector<common::icp::balancer_real_find::real> filtered_reals;
-			for (auto& [real_ip, real_port, enabled, weight, connections, packets, bytes] : response_reals)
+			std::vector<balancer::real_counter_key_t> keys;
+			for (auto& real : response_reals)
 			{
+				const auto& [real_ip, real_port, enabled, weight, connections, packets, bytes] = real;
+				GCC_BUG_UNUSED(enabled);
+				GCC_BUG_UNUSED(weight);
 				GCC_BUG_UNUSED(connections); ///< @todo: DELETE
 				GCC_BUG_UNUSED(packets);
 				GCC_BUG_UNUSED(bytes);
@@ -636,16 +638,25 @@ common::icp::balancer_real_find::response balancer_t::balancer_real_find(const c
 					continue;
 				}
 
-				auto it = counters.find({module_name,
-				                         {virtual_ip, proto, virtual_port},
-				                         {real_ip, real_port}});
-				if (it != counters.end())
+				filtered_reals.emplace_back(real);
+				keys.push_back({module_name,
+				                {virtual_ip, proto, virtual_port},
+				                {real_ip, real_port}});
+			}
+
+			/// only counters of filtered reals are read
+			const auto counters = real_counters.get_counters(keys);
+
+			response_reals.clear();
+			for (size_t real_i = 0; real_i < filtered_reals.size(); real_i++)
+			{
+				if (counters[real_i])
 				{
-					filtered_reals.emplace_back(real_ip, real_port, enabled, weight, connections, (it->second)[0], (it->second)[1]);
+					auto& real = response_reals.emplace_back(filtered_reals[real_i]);
+					std::get<5>(real) = (*counters[real_i])[0]; ///< packets
+					std::get<6>(real) = (*counters[real_i])[1]; ///< bytes
 				}
 			}
-
-			filtered_reals.swap(response_reals);
 		}
 	}
 
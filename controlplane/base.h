@@ -394,6 +394,10 @@ public:
 	ipv4_address_t ipv4_address{};
 	ipv6_address_t ipv6_address{};
 	bool show_real_address{};
+	uint32_t time_exceeded_rate{}; ///< zero is unlimited
+	uint32_t time_exceeded_burst{};
+	uint8_t time_exceeded_ipv4_prefix{24};
+	uint8_t time_exceeded_ipv6_prefix{64};
 };
 }
 
@@ -591,6 +591,113 @@ void config_converter_t::processNat64()
 			                                                                                                range});
 		}
 	}
+
+	/// 1:1 translations which are resolved by dataplane lookup instead of acl
+	common::idp::updateGlobalBase::nat64stateless_lookup_update::request lookup_request;
+	auto& [lookup_ingress, lookup_egress] = lookup_request;
+
+	for (const auto& [moduleName, nat64stateless] : baseNext.nat64statelesses)
+	{
+		GCC_BUG_UNUSED(moduleName);
+
+		const auto translation_ids = nat64stateless_lookup_translations(nat64stateless);
+		std::set<std::tuple<ipv6_address_t, ipv6_address_t>> ipv6_addresses;
+		std::set<ipv4_address_t> ipv4_addresses;
+
+		for (const auto& [key, value] : nat64stateless.translations)
+		{
+			const auto& [ipv6Address, ipv6DestinationAddress, ingressPortRange] = key;
+			const auto& [ipv4Address, egressPortRange, translationId] = value;
+
+			GCC_BUG_UNUSED(ingressPortRange);
+			GCC_BUG_UNUSED(egressPortRange);
+
+			if (!translation_ids.count(translationId))
+			{
+				continue;
+			}
+
+			/// first translation of addresses is used, as first acl rule did
+			if (ipv6_addresses.emplace(ipv6Address, ipv6DestinationAddress.applyMask(96)).second)
+			{
+				lookup_ingress.emplace_back(nat64stateless.nat64statelessId,
+				                            ipv6Address,
+				                            ipv6DestinationAddress,
+				                            translationId);
+			}
+
+			if (ipv4_addresses.emplace(ipv4Address).second)
+			{
+				lookup_egress.emplace_back(nat64stateless.nat64statelessId,
+				                           ipv4Address,
+				                           translationId);
+			}
+		}
+	}
+
+	globalbase.emplace_back(common::idp::updateGlobalBase::requestType::nat64stateless_lookup_update,
+	                        lookup_request);
+}
+
+std::set<tNat64statelessTranslationId> config_converter_t::nat64stateless_lookup_translations(const controlplane::base::nat64stateless_t& nat64stateless)
+{
+	/// 1:1 translation is resolved by lookup if its addresses are not covered by any acl rule
+	/// of port range translations, so acl result does not depend on order of rules
+	std::set<std::tuple<ipv6_address_t, ipv6_address_t>> ranged_ipv6_addresses;
+	std::set<ipv4_address_t> ranged_ipv4_addresses;
+
+	for (const auto& [key, value] : nat64stateless.translations)
+	{
+		const auto& [ipv6Address, ipv6DestinationAddress, ingressPortRange] = key;
+		const auto& [ipv4Address, egressPortRange, translationId] = value;
+
+		GCC_BUG_UNUSED(translationId);
+
+		if (ingressPortRange)
+		{
+			ranged_ipv6_addresses.emplace(ipv6Address, ipv6DestinationAddress.applyMask(96));
+		}
+
+		if (egressPortRange)
+		{
+			ranged_ipv4_addresses.emplace(ipv4Address);
+		}
+	}
+
+	/// 1:1 translation remained in acl keeps its ipv4 address in acl for all translations
+	std::set<ipv4_address_t> acl_ipv4_addresses = ranged_ipv4_addresses;
+	for (const auto& [key, value] : nat64stateless.translations)
+	{
+		const auto& [ipv6Address, ipv6DestinationAddress, ingressPortRange] = key;
+		const auto& [ipv4Address, egressPortRange, translationId] = value;
+
+		GCC_BUG_UNUSED(translationId);
+
+		if (!ingressPortRange && !egressPortRange &&
+		    ranged_ipv6_addresses.count({ipv6Address, ipv6DestinationAddress.applyMask(96)}))
+		{
+			acl_ipv4_addresses.emplace(ipv4Address);
+		}
+	}
+
+	std::set<tNat64statelessTranslationId> result;
+	for (const auto& [key, value] : nat64stateless.translations)
+	{
+		const auto& [ipv6Address, ipv6DestinationAddress, ingressPortRange] = key;
+		const auto& [ipv4Address, egressPortRange, translationId] = value;
+
+		if (ingressPortRange ||
+		    egressPortRange ||
+		    ranged_ipv6_addresses.count({ipv6Address, ipv6DestinationAddress.applyMask(96)}) ||
+		    acl_ipv4_addresses.count(ipv4Address))
+		{
+			continue;
+		}
+
+		result.emplace(translationId);
+	}
+
+	return result;
 }
 
 void config_converter_t::processNat46clat()
@@ -856,7 +963,11 @@ void config_converter_t::processHostConfig()
 	                        common::idp::updateGlobalBase::update_host_config::request{
 	                                baseNext.host_config.ipv4_address,
 	                                baseNext.host_config.ipv6_address,
-	                                baseNext.host_config.show_real_address});
+	                                baseNext.host_config.show_real_address,
+	                                baseNext.host_config.time_exceeded_rate,
+	                                baseNext.host_config.time_exceeded_burst,
+	                                baseNext.host_config.time_exceeded_ipv4_prefix,
+	                                baseNext.host_config.time_exceeded_ipv6_prefix});
 }
 
 void config_converter_t::acl_rules_early_decap(controlplane::base::acl_t& acl) const
@@ -1148,6 +1259,50 @@ void config_converter_t::acl_rules_nat64stateless_ingress(controlplane::base::ac
 
 	auto flow_drop = convertToFlow("drop");
 
+	auto rules_one_to_one = [&](const controlplane::base::acl_rule_network_ipv6_t& rule_network) {
+		{
+			controlplane::base::acl_rule_transport_icmpv6_t rule_transport{values_t{ICMP6_ECHO_REQUEST, ICMP6_ECHO_REPLY},
+			                                                               range_t{0x00, 0xFF},
+			                                                               range_t{0x0000, 0xFFFF}};
+			acl.nextModuleRules.emplace_back(rule_network, fragState::notFragmented, rule_transport, flow);
+		}
+
+		{
+			controlplane::base::acl_rule_transport_icmpv6_t rule_transport{range_t{0x00, 0xFF},
+			                                                               range_t{0x00, 0xFF},
+			                                                               range_t{0x0000, 0xFFFF}};
+			acl.nextModuleRules.emplace_back(rule_network, fragState::notFragmented, rule_transport, flow_icmp);
+		}
+
+		{
+			controlplane::base::acl_rule_transport_icmpv6_t rule_transport{values_t{ICMP6_ECHO_REQUEST, ICMP6_ECHO_REPLY},
+			                                                               range_t{0x00, 0xFF},
+			                                                               range_t{0x0000, 0xFFFF}};
+			acl.nextModuleRules.emplace_back(rule_network, fragState::firstFragment, rule_transport, flow_fragmentation);
+		}
+
+		{
+			controlplane::base::acl_rule_transport_icmpv6_t rule_transport{range_t{0x00, 0xFF},
+			                                                               range_t{0x00, 0xFF},
+			                                                               range_t{0x0000, 0xFFFF}};
+			acl.nextModuleRules.emplace_back(rule_network, fragState::notFirstFragment, rule_transport, flow_fragmentation);
+		}
+
+		{
+			controlplane::base::acl_rule_transport_icmpv6_t rule_transport{range_t{0x00, 0xFF},
+			                                                               range_t{0x00, 0xFF},
+			                                                               range_t{0x0000, 0xFFFF}};
+			acl.nextModuleRules.emplace_back(rule_network, rule_transport, flow_drop);
+		}
+
+		acl.nextModuleRules.emplace_back(rule_network, flow);
+	};
+
+	const auto lookup_translations = nat64stateless_lookup_translations(nat64stateless);
+
+	/// 1:1 translations resolved by dataplane lookup, grouped by destination prefix
+	std::map<ipv6_address_t, std::set<ipv6_prefix_t>> lookup_sources;
+
 	for (const auto& [key, value] : nat64stateless.translations)
 	{
 		const auto& [ipv6Address, ipv6DestinationAddress, ingressPortRange] = key;
@@ -1156,6 +1311,12 @@ void config_converter_t::acl_rules_nat64stateless_ingress(controlplane::base::ac
 		GCC_BUG_UNUSED(ipv4Address);
 		GCC_BUG_UNUSED(egressPortRange);
 
+		if (lookup_translations.count(translationId))
+		{
+			lookup_sources[ipv6DestinationAddress.applyMask(96)].emplace(ipv6Address, 128);
+			continue;
+		}
+
 		flow.data.nat64stateless.translationId = translationId;
 		flow_icmp.data.nat64stateless.translationId = translationId;
 		flow_fragmentation.data.nat64stateless.translationId = translationId;
@@ -1167,42 +1328,7 @@ void config_converter_t::acl_rules_nat64stateless_ingress(controlplane::base::ac
 		{
 			/// 1:1
 
-			{
-				controlplane::base::acl_rule_transport_icmpv6_t rule_transport{values_t{ICMP6_ECHO_REQUEST, ICMP6_ECHO_REPLY},
-				                                                               range_t{0x00, 0xFF},
-				                                                               range_t{0x0000, 0xFFFF}};
-				acl.nextModuleRules.emplace_back(rule_network, fragState::notFragmented, rule_transport, flow);
-			}
-
-			{
-				controlplane::base::acl_rule_transport_icmpv6_t rule_transport{range_t{0x00, 0xFF},
-				                                                               range_t{0x00, 0xFF},
-				                                                               range_t{0x0000, 0xFFFF}};
-				acl.nextModuleRules.emplace_back(rule_network, fragState::notFragmented, rule_transport, flow_icmp);
-			}
-
-			{
-				controlplane::base::acl_rule_transport_icmpv6_t rule_transport{values_t{ICMP6_ECHO_REQUEST, ICMP6_ECHO_REPLY},
-				                                                               range_t{0x00, 0xFF},
-				                                                               range_t{0x0000, 0xFFFF}};
-				acl.nextModuleRules.emplace_back(rule_network, fragState::firstFragment, rule_transport, flow_fragmentation);
-			}
-
-			{
-				controlplane::base::acl_rule_transport_icmpv6_t rule_transport{range_t{0x00, 0xFF},
-				                                                               range_t{0x00, 0xFF},
-				                                                               range_t{0x0000, 0xFFFF}};
-				acl.nextModuleRules.emplace_back(rule_network, fragState::notFirstFragment, rule_transport, flow_fragmentation);
-			}
-
-			{
-				controlplane::base::acl_rule_transport_icmpv6_t rule_transport{range_t{0x00, 0xFF},
-				                                                               range_t{0x00, 0xFF},
-				                                                               range_t{0x0000, 0xFFFF}};
-				acl.nextModuleRules.emplace_back(rule_network, rule_transport, flow_drop);
-			}
-
-			acl.nextModuleRules.emplace_back(rule_network, flow);
+			rules_one_to_one(rule_network);
 		}
 		else
 		{
@@ -1288,6 +1414,15 @@ void config_converter_t::acl_rules_nat64stateless_ingress(controlplane::base::ac
 			}
 		}
 	}
+
+	flow.data.nat64stateless.translationId = common::globalBase::nat64stateless_translation_lookup;
+	flow_icmp.data.nat64stateless.translationId = common::globalBase::nat64stateless_translation_lookup;
+	flow_fragmentation.data.nat64stateless.translationId = common::globalBase::nat64stateless_translation_lookup;
+
+	for (const auto& [ipv6DestinationAddress, sources] : lookup_sources)
+	{
+		rules_one_to_one({sources, {{ipv6DestinationAddress, 96}}});
+	}
 }
 
 void config_converter_t::acl_rules_nat64stateless_egress(controlplane::base::acl_t& acl,
@@ -1312,110 +1447,125 @@ void config_converter_t::acl_rules_nat64stateless_egress(controlplane::base::acl
 		acl.nextModuleRules.emplace_back(rule_network, flow_farm);
 	}
 
-	for (const auto& [key, value] : nat64stateless.translations)
-	{
-		GCC_BUG_UNUSED(key);
-
-		const auto& [ipv4Address, egressPortRange, translationId] = value;
-
-		flow.data.nat64stateless.translationId = translationId;
-		flow_icmp.data.nat64stateless.translationId = translationId;
-		flow_fragmentation.data.nat64stateless.translationId = translationId;
-
-		controlplane::base::acl_rule_network_ipv4_t rule_network({common::ipv4_prefix_default},
-		                                                         {{ipv4Address, 32}});
-
-		if (!egressPortRange)
+	auto rules_one_to_one = [&](const controlplane::base::acl_rule_network_ipv4_t& rule_network) {
+		if (nat64stateless.firewall)
 		{
-			/// 1:1
-
-			if (nat64stateless.firewall)
 			{
-				{
-					controlplane::base::acl_rule_transport_tcp_t rule_transport{range_t{0x0000, 0xFFFF},
-					                                                            range_t{0x0000, 0xFFFF}};
-					rule_transport.flags = {TCP_SYN_FLAG, TCP_ACK_FLAG};
-					acl.nextModuleRules.emplace_back(rule_network, rule_transport, flow_drop);
-				}
-
-				{
-					controlplane::base::acl_rule_transport_tcp_t rule_transport{range_t{0x0000, 0xFFFF},
-					                                                            range_t{0x0000, 0xFFFF}};
-					rule_transport.flags = {0, TCP_SYN_FLAG | TCP_FIN_FLAG | TCP_ACK_FLAG | TCP_PSH_FLAG | TCP_RST_FLAG | TCP_URG_FLAG};
-					acl.nextModuleRules.emplace_back(rule_network, rule_transport, flow_drop);
-				}
-
-				{
-					controlplane::base::acl_rule_transport_tcp_t rule_transport{range_t{0x0000, 0xFFFF},
-					                                                            range_t{0x0000, 0xFFFF}};
-					rule_transport.flags = {TCP_FIN_FLAG | TCP_PSH_FLAG | TCP_URG_FLAG, 0};
-					acl.nextModuleRules.emplace_back(rule_network, rule_transport, flow_drop);
-				}
-
-				{
-					controlplane::base::acl_rule_transport_udp_t rule_transport{range_t{0x0000, 0xFFFF},
-					                                                            range_t{0x0000, 0xFFFF}};
-					rule_transport.sourcePorts.remove(53);
-					acl.nextModuleRules.emplace_back(rule_network, rule_transport, flow_drop);
-				}
-
-				{
-					controlplane::base::acl_rule_transport_icmpv4_t rule_transport{range_t{0x00, 0xFF},
-					                                                               range_t{0x00, 0xFF},
-					                                                               range_t{0x0000, 0xFFFF}};
-					rule_transport.types.remove(ICMP_ECHOREPLY);
-					rule_transport.types.remove(ICMP_ECHO);
-					rule_transport.types.remove(ICMP_DEST_UNREACH);
-					rule_transport.types.remove(ICMP_TIME_EXCEEDED);
-					rule_transport.types.remove(ICMP_PARAMETERPROB);
-					acl.nextModuleRules.emplace_back(rule_network, rule_transport, flow_drop);
-				}
-
-				{
-					controlplane::base::acl_rule_transport_other_t rule_transport{range_t{0x00, 0xFF}};
-					rule_transport.protocolTypes.remove(IPPROTO_TCP);
-					rule_transport.protocolTypes.remove(IPPROTO_UDP);
-					rule_transport.protocolTypes.remove(IPPROTO_ICMP);
-					acl.nextModuleRules.emplace_back(rule_network, rule_transport, flow_drop);
-				}
+				controlplane::base::acl_rule_transport_tcp_t rule_transport{range_t{0x0000, 0xFFFF},
+				                                                            range_t{0x0000, 0xFFFF}};
+				rule_transport.flags = {TCP_SYN_FLAG, TCP_ACK_FLAG};
+				acl.nextModuleRules.emplace_back(rule_network, rule_transport, flow_drop);
 			}
 
 			{
-				controlplane::base::acl_rule_transport_icmpv4_t rule_transport{values_t{ICMP_ECHO, ICMP_ECHOREPLY},
-				                                                               range_t{0x00, 0xFF},
-				                                                               range_t{0x0000, 0xFFFF}};
-				acl.nextModuleRules.emplace_back(rule_network, fragState::notFragmented, rule_transport, flow);
+				controlplane::base::acl_rule_transport_tcp_t rule_transport{range_t{0x0000, 0xFFFF},
+				                                                            range_t{0x0000, 0xFFFF}};
+				rule_transport.flags = {0, TCP_SYN_FLAG | TCP_FIN_FLAG | TCP_ACK_FLAG | TCP_PSH_FLAG | TCP_RST_FLAG | TCP_URG_FLAG};
+				acl.nextModuleRules.emplace_back(rule_network, rule_transport, flow_drop);
 			}
 
 			{
-				controlplane::base::acl_rule_transport_icmpv4_t rule_transport{range_t{0x00, 0xFF},
-				                                                               range_t{0x00, 0xFF},
-				                                                               range_t{0x0000, 0xFFFF}};
-				acl.nextModuleRules.emplace_back(rule_network, fragState::notFragmented, rule_transport, flow_icmp);
+				controlplane::base::acl_rule_transport_tcp_t rule_transport{range_t{0x0000, 0xFFFF},
+				                                                            range_t{0x0000, 0xFFFF}};
+				rule_transport.flags = {TCP_FIN_FLAG | TCP_PSH_FLAG | TCP_URG_FLAG, 0};
+				acl.nextModuleRules.emplace_back(rule_network, rule_transport, flow_drop);
 			}
 
 			{
-				controlplane::base::acl_rule_transport_icmpv4_t rule_transport{values_t{ICMP_ECHO, ICMP_ECHOREPLY},
-				                                                               range_t{0x00, 0xFF},
-				                                                               range_t{0x0000, 0xFFFF}};
-				acl.nextModuleRules.emplace_back(rule_network, fragState::firstFragment, rule_transport, flow_fragmentation);
+				controlplane::base::acl_rule_transport_udp_t rule_transport{range_t{0x0000, 0xFFFF},
+				                                                            range_t{0x0000, 0xFFFF}};
+				rule_transport.sourcePorts.remove(53);
+				acl.nextModuleRules.emplace_back(rule_network, rule_transport, flow_drop);
 			}
 
 			{
 				controlplane::base::acl_rule_transport_icmpv4_t rule_transport{range_t{0x00, 0xFF},
 				                                                               range_t{0x00, 0xFF},
 				                                                               range_t{0x0000, 0xFFFF}};
-				acl.nextModuleRules.emplace_back(rule_network, fragState::notFirstFragment, rule_transport, flow_fragmentation);
+				rule_transport.types.remove(ICMP_ECHOREPLY);
+				rule_transport.types.remove(ICMP_ECHO);
+				rule_transport.types.remove(ICMP_DEST_UNREACH);
+				rule_transport.types.remove(ICMP_TIME_EXCEEDED);
+				rule_transport.types.remove(ICMP_PARAMETERPROB);
+				acl.nextModuleRules.emplace_back(rule_network, rule_transport, flow_drop);
 			}
 
 			{
-				controlplane::base::acl_rule_transport_icmpv4_t rule_transport{range_t{0x00, 0xFF},
-				                                                               range_t{0x00, 0xFF},
-				                                                               range_t{0x0000, 0xFFFF}};
+				controlplane::base::acl_rule_transport_other_t rule_transport{range_t{0x00, 0xFF}};
+				rule_transport.protocolTypes.remove(IPPROTO_TCP);
+				rule_transport.protocolTypes.remove(IPPROTO_UDP);
+				rule_transport.protocolTypes.remove(IPPROTO_ICMP);
 				acl.nextModuleRules.emplace_back(rule_network, rule_transport, flow_drop);
 			}
+		}
+
+		{
+			controlplane::base::acl_rule_transport_icmpv4_t rule_transport{values_t{ICMP_ECHO, ICMP_ECHOREPLY},
+			                                                               range_t{0x00, 0xFF},
+			                                                               range_t{0x0000, 0xFFFF}};
+			acl.nextModuleRules.emplace_back(rule_network, fragState::notFragmented, rule_transport, flow);
+		}
+
+		{
+			controlplane::base::acl_rule_transport_icmpv4_t rule_transport{range_t{0x00, 0xFF},
+			                                                               range_t{0x00, 0xFF},
+			                                                               range_t{0x0000, 0xFFFF}};
+			acl.nextModuleRules.emplace_back(rule_network, fragState::notFragmented, rule_transport, flow_icmp);
+		}
+
+		{
+			controlplane::base::acl_rule_transport_icmpv4_t rule_transport{values_t{ICMP_ECHO, ICMP_ECHOREPLY},
+			                                                               range_t{0x00, 0xFF},
+			                                                               range_t{0x0000, 0xFFFF}};
+			acl.nextModuleRules.emplace_back(rule_network, fragState::firstFragment, rule_transport, flow_fragmentation);
+		}
+
+		{
+			controlplane::base::acl_rule_transport_icmpv4_t rule_transport{range_t{0x00, 0xFF},
+			                                                               range_t{0x00, 0xFF},
+			                                                               range_t{0x0000, 0xFFFF}};
+			acl.nextModuleRules.emplace_back(rule_network, fragState::notFirstFragment, rule_transport, flow_fragmentation);
+		}
+
+		{
+			controlplane::base::acl_rule_transport_icmpv4_t rule_transport{range_t{0x00, 0xFF},
+			                                                               range_t{0x00, 0xFF},
+			                                                               range_t{0x0000, 0xFFFF}};
+			acl.nextModuleRules.emplace_back(rule_network, rule_transport, flow_drop);
+		}
+
+		acl.nextModuleRules.emplace_back(rule_network, flow);
+	};
+
+	const auto lookup_translations = nat64stateless_lookup_translations(nat64stateless);
+
+	/// 1:1 translations resolved by dataplane lookup
+	std::set<ipv4_prefix_t> lookup_destinations;
+
+	for (const auto& [key, value] : nat64stateless.translations)
+	{
+		GCC_BUG_UNUSED(key);
+
+		const auto& [ipv4Address, egressPortRange, translationId] = value;
 
-			acl.nextModuleRules.emplace_back(rule_network, flow);
+		if (lookup_translations.count(translationId))
+		{
+			lookup_destinations.emplace(ipv4Address, 32);
+			continue;
+		}
+
+		flow.data.nat64stateless.translationId = translationId;
+		flow_icmp.data.nat64stateless.translationId = translationId;
+		flow_fragmentation.data.nat64stateless.translationId = translationId;
+
+		controlplane::base::acl_rule_network_ipv4_t rule_network({common::ipv4_prefix_default},
+		                                                         {{ipv4Address, 32}});
+
+		if (!egressPortRange)
+		{
+			/// 1:1
+
+			rules_one_to_one(rule_network);
 		}
 		else
 		{
@@ -1546,6 +1696,15 @@ void config_converter_t::acl_rules_nat64stateless_egress(controlplane::base::acl
 			}
 		}
 	}
+
+	if (!lookup_destinations.empty())
+	{
+		flow.data.nat64stateless.translationId = common::globalBase::nat64stateless_translation_lookup;
+		flow_icmp.data.nat64stateless.translationId = common::globalBase::nat64stateless_translation_lookup;
+		flow_fragmentation.data.nat64stateless.translationId = common::globalBase::nat64stateless_translation_lookup;
+
+		rules_one_to_one({{common::ipv4_prefix_default}, lookup_destinations});
+	}
 }
 
 void config_converter_t::acl_rules_nat46clat(controlplane::base::acl_t& acl,
@@ -1935,6 +2094,7 @@ void config_converter_t::buildAcl()
 	globalbase.emplace_back(common::idp::updateGlobalBase::requestType::acl_total_table, std::move(result.acl_total_table));
 	globalbase.emplace_back(common::idp::updateGlobalBase::requestType::acl_values, std::move(result.acl_values));
 	globalbase.emplace_back(common::idp::updateGlobalBase::requestType::dump_tags_ids, std::move(result.dump_id_to_tag));
+	globalbase.emplace_back(common::idp::updateGlobalBase::requestType::acl_meters, std::move(result.acl_meters));
 
 	common::idp::updateGlobalBase::fwstate_synchronization_update::request fwstate_sync_request;
 	for (const auto& [moduleName, acl] : baseNext.acls)
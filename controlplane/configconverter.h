@@ -50,6 +50,8 @@ protected:
 
 	std::string checkLimit(size_t count, const std::string& limit, size_t multiplier(size_t));
 
+	static std::set<tNat64statelessTranslationId> nat64stateless_lookup_translations(const controlplane::base::nat64stateless_t& nat64stateless);
+
 	void convertToFlow(const std::string& nextModule, common::globalBase::tFlow& flow) const;
 	[[nodiscard]] common::globalBase::tFlow convertToFlow(std::string nextModule) const;
 	[[nodiscard]] common::globalBase::tFlow convertToFlow(std::string nextModule, const std::string& entryName) const;
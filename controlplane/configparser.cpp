@@ -2026,4 +2026,25 @@ void config_parser_t::loadConfig_host(controlplane::base::host_t& host_config, c
 	{
 		host_config.show_real_address = json["showRealAddress"].get<bool>();
 	}
+
+	if (exist(json, "timeExceededLimit"))
+	{
+		const auto& limit_json = json["timeExceededLimit"];
+
+		host_config.time_exceeded_rate = limit_json["rate"].get<uint32_t>();
+		host_config.time_exceeded_burst = limit_json.value("burst", host_config.time_exceeded_rate);
+
+		/// parsed wider than stored, so out of range values are not wrapped
+		int64_t ipv4_prefix = limit_json.value("ipv4Prefix", (int64_t)host_config.time_exceeded_ipv4_prefix);
+		int64_t ipv6_prefix = limit_json.value("ipv6Prefix", (int64_t)host_config.time_exceeded_ipv6_prefix);
+
+		if (ipv4_prefix < 0 || ipv4_prefix > 32 ||
+		    ipv6_prefix < 0 || ipv6_prefix > 128)
+		{
+			throw error_result_t(eResult::invalidConfigurationFile, "hostConfig: invalid timeExceededLimit prefix");
+		}
+
+		host_config.time_exceeded_ipv4_prefix = ipv4_prefix;
+		host_config.time_exceeded_ipv6_prefix = ipv6_prefix;
+	}
 }
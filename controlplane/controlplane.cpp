@@ -120,6 +120,10 @@ eResult cControlPlane::init(const std::string& jsonFilePath)
 		return command_getFwList(std::get<common::icp::getFwList::request>(std::get<1>(request)));
 	});
 
+	register_command(common::icp::requestType::get_fw_states, [this](const common::icp::request& request) {
+		return command_get_fw_states(std::get<common::icp::get_fw_states::request>(std::get<1>(request)));
+	});
+
 	register_command(common::icp::requestType::loadConfig, [this](const common::icp::request& request) {
 		return command_loadConfig(std::get<common::icp::loadConfig::request>(std::get<1>(request)));
 	});
@@ -675,7 +679,19 @@ common::icp::getFwList::response cControlPlane::command_getFwList(const common::
 		        {IPPROTO_ICMPV6, "ipv6-icmp"},
 		};
 
-		for (const auto& [key, value] : dataPlane.getFWState())
+		/// fetch states page by page, so dataplane never copies whole table at once
+		constexpr uint32_t page_limit = 4096;
+
+		common::idp::getFWState::response states;
+		std::optional<common::idp::getFWState::key_t> cursor;
+		do
+		{
+			auto [page, next_cursor] = dataPlane.get_fw_state_page({{}, cursor, page_limit});
+			states.merge(page);
+			cursor = next_cursor;
+		} while (cursor);
+
+		for (const auto& [key, value] : states)
 		{
 			const auto& [proto, src_addr, dst_addr, src_port, dst_port] = key;
 			const auto& [owner, flags, last_seen, counter_backward, counter_forward] = value;
@@ -713,6 +729,11 @@ common::icp::getFwList::response cControlPlane::command_getFwList(const common::
 	return response;
 }
 
+common::icp::get_fw_states::response cControlPlane::command_get_fw_states(const common::icp::get_fw_states::request& request)
+{
+	return dataPlane.get_fw_state_page(request);
+}
+
 void cControlPlane::command_clearFWState()
 {
 	dataPlane.clearFWState();
@@ -125,6 +125,7 @@ protected: /** commands */
 	common::icp::getNat64statelessPrefixes::response command_getNat64statelessPrefixes();
 	common::icp::getFwLabels::response command_getFwLabels();
 	common::icp::getFwList::response command_getFwList(const common::icp::getFwList::request& request);
+	common::icp::get_fw_states::response command_get_fw_states(const common::icp::get_fw_states::request& request);
 	void command_clearFWState();
 	common::icp::getSamples::response command_getSamples();
 	common::icp::getAclConfig::response command_getAclConfig(common::icp::getAclConfig::request);
@@ -4,7 +4,11 @@
 #include "common/sdpclient.h"
 #include "common/sdpcommon.h"
 #include "segment_allocator.h"
+#include <algorithm>
+#include <map>
 #include <mutex>
+#include <optional>
+#include <unordered_map>
 
 class counter_manager_t
 {
@@ -98,6 +102,21 @@ protected:
 		return result;
 	}
 
+	/// values of contiguous counter ids [counter_id, counter_id + values.size())
+	void counter_get_range(const tCounterId counter_id,
+	                       std::vector<uint64_t>& values) const
+	{
+		common::sdp::SdpClient::GetCountersRange(*sdp_data, counter_id, values);
+
+		std::lock_guard<std::mutex> guard(counter_mutex);
+		for (unsigned int i = 0;
+		     i < values.size() && counter_id + i < YANET_CONFIG_COUNTERS_SIZE;
+		     i++)
+		{
+			values[i] -= counter_shifts[counter_id + i];
+		}
+	}
+
 	void counter_release(tCounterId counter_id, size_t size)
 	{
 		std::lock_guard<std::mutex> guard(counter_mutex);
@@ -114,12 +133,46 @@ protected:
 	const common::sdp::DataPlaneInSharedMemory* sdp_data;
 };
 
+/// Hash of counter key, tuples are hashed by elements.
+template<typename type_T>
+struct counter_hash_t
+{
+	std::size_t operator()(const type_T& value) const
+	{
+		return std::hash<type_T>()(value);
+	}
+};
+
+template<typename... types_T>
+struct counter_hash_t<std::tuple<types_T...>>
+{
+	std::size_t operator()(const std::tuple<types_T...>& value) const
+	{
+		std::size_t result = 0;
+		std::apply([&result](const auto&... elements) {
+			((result ^= counter_hash_t<std::decay_t<decltype(elements)>>()(elements) + 0x9e3779b9 + (result << 6) + (result >> 2)), ...);
+		},
+		           value);
+		return result;
+	}
+};
+
+/// Counters of keys, each key has `size_T` contiguous counter ids.
+///
+/// Keys are placed in dense slots. Slots are grouped by chunks, each chunk is one
+/// segment of counter_manager_t, so values of chunk are read by one range read.
+/// Freed slots are reused, chunk is released to counter_manager_t when its last slot is freed.
+/// Chunk which failed to reserve uses fallback counter until a reservation of it succeeds.
 template<typename key_T,
          size_t size_T>
 class counter_t
 {
 public:
 	static_assert(size_T <= YANET_CONFIG_COUNTER_FALLBACK_SIZE);
+	static_assert(size_T <= counter_manager_t::max_buffer_size);
+
+	/// version and previous values of allocated counters, indexed by slot
+	using snapshot_t = std::vector<std::tuple<uint32_t, std::array<uint64_t, size_T>>>;
 
 	counter_t() = default;
 
@@ -134,18 +187,23 @@ public:
 		std::lock_guard<std::mutex> guard(mutex);
 
 		std::vector<tCounterId> counter_ids;
-		counter_ids.reserve(counters_inserted.size() * size_T);
-		for (const auto& [key, counter_id] : counters_inserted)
+		counter_ids.reserve(slots_inserted.size() * size_T);
+		for (const auto slot_id : slots_inserted)
 		{
-			for (size_t index = 0; index < size_T; index++)
+			auto& slot = slots[slot_id];
+
+			const auto counter_id = get_counter_id(slot_id);
+			for (size_t counter_i = 0; counter_i < size_T; counter_i++)
 			{
-				counter_ids.push_back(counter_id + index);
+				counter_ids.push_back(counter_id + counter_i);
 			}
 
-			counters_allocated.emplace(key, counter_id);
-			callback(key);
+			slot.state = state_e::allocated;
+			slot.version++;
+			allocated_count++;
+			callback(slot.key);
 		}
-		counters_inserted.clear();
+		slots_inserted.clear();
 
 		manager->counter_allocate(counter_ids);
 	}
@@ -160,14 +218,13 @@ public:
 	{
 		std::lock_guard<std::mutex> guard(mutex);
 
-		for (const auto& [key, counter_id] : counters_gc_removed)
+		for (const auto slot_id : slots_gc_removed)
 		{
-			callback(key);
-			counters.erase(key);
-			counters_allocated.erase(key);
-			manager->counter_release(counter_id, size_T);
+			callback(slots[slot_id].key);
+			allocated_count--;
+			slot_free(slot_id);
 		}
-		counters_gc_removed.clear();
+		slots_gc_removed.clear();
 	}
 
 	void release()
@@ -179,28 +236,32 @@ public:
 	{
 		std::lock_guard<std::mutex> guard(mutex);
 
-		auto counters_it = counters.find(key);
-		if (counters_it != counters.end())
+		auto index_it = index.find(key);
+		if (index_it != index.end())
 		{
-			auto& [counter_id, refcount] = counters_it->second;
-			GCC_BUG_UNUSED(counter_id);
+			const auto slot_id = index_it->second;
+			auto& slot = slots[slot_id];
 
-			if (!refcount)
+			if (!slot.refcount)
 			{
-				counters_removed.erase(key);
-				counters_gc_removed.erase(key);
+				/// cancel removing
+				list_erase(slot_id);
+				slot.state = state_e::allocated;
 			}
 
-			refcount++;
+			slot.refcount++;
 		}
 		else
 		{
-			const auto counter_id = manager->counter_reserve(size_T);
+			const auto slot_id = slot_acquire();
+			auto& slot = slots[slot_id];
 
-			counters.emplace_hint(counters_it,
-			                      key,
-			                      std::tuple<tCounterId, uint32_t>(counter_id, 1));
-			counters_inserted.emplace(key, counter_id);
+			slot.key = key;
+			slot.refcount = 1;
+			slot.state = state_e::inserted;
+			list_push(slot_id);
+
+			index.emplace_hint(index_it, key, slot_id);
 		}
 	}
 
@@ -209,47 +270,41 @@ public:
 	{
 		std::lock_guard<std::mutex> guard(mutex);
 
-		auto counters_it = counters.find(key);
-		if (counters_it != counters.end())
+		auto index_it = index.find(key);
+		if (index_it == index.end())
 		{
-			auto& [counter_id, refcount] = counters_it->second;
-
-			if (!refcount)
-			{
-				/// @todo: delete
-				YANET_LOG_WARNING("wrong refcount\n");
-			}
+			/// @todo: delete
+			YANET_LOG_WARNING("unknown counter\n");
+			return;
+		}
 
-			refcount--;
+		const auto slot_id = index_it->second;
+		auto& slot = slots[slot_id];
 
-			if (!refcount)
-			{
-				auto counters_inserted_it = counters_inserted.find(key);
-				if (counters_inserted_it != counters_inserted.end())
-				{
-					manager->counter_release(counters_inserted_it->second, size_T);
+		if (!slot.refcount)
+		{
+			/// @todo: delete
+			YANET_LOG_WARNING("wrong refcount\n");
+			return;
+		}
 
-					if (counters_allocated.count(key))
-					{
-						YANET_LOG_WARNING("was allocated\n");
-					}
+		slot.refcount--;
 
-					counters_inserted.erase(counters_inserted_it);
-					counters.erase(counters_it);
-				}
-				else
-				{
-					uint32_t timestamp = time(nullptr);
-					timestamp += timeout;
+		if (!slot.refcount)
+		{
+			list_erase(slot_id);
 
-					counters_removed.emplace(key, std::tuple<tCounterId, uint32_t>(counter_id, timestamp));
-				}
+			if (slot.state == state_e::inserted)
+			{
+				/// not allocated yet, dataplane does not know counter id
+				slot_free(slot_id);
+			}
+			else
+			{
+				slot.state = state_e::removed;
+				slot.timestamp = time(nullptr) + timeout;
+				list_push(slot_id);
 			}
-		}
-		else
-		{
-			/// @todo: delete
-			YANET_LOG_WARNING("unknown counter\n");
 		}
 	}
 
@@ -257,88 +312,331 @@ public:
 	{
 		std::lock_guard<std::mutex> guard(mutex);
 
-		auto iter = counters.find(key);
-		if (iter == counters.end())
+		auto index_it = index.find(key);
+		if (index_it == index.end())
 		{
 			/// fallback
 			return 0;
 		}
 
-		const auto& [counter_id, refcount] = iter->second;
-		GCC_BUG_UNUSED(refcount);
-
-		return counter_id;
+		return get_counter_id(index_it->second);
 	}
 
 	std::map<key_T, std::array<uint64_t, size_T>> get_counters() const ///< get_values
 	{
+		std::map<key_T, std::array<uint64_t, size_T>> result;
+
 		std::lock_guard<std::mutex> guard(mutex);
+		for_each_allocated([&result](const uint32_t slot_id, const slot_t& slot, const std::array<uint64_t, size_T>& values) {
+			GCC_BUG_UNUSED(slot_id);
+			result.emplace(slot.key, values);
+		});
+
+		return result;
+	}
+
+	/// Values of given keys, std::nullopt for not allocated keys.
+	std::vector<std::optional<std::array<uint64_t, size_T>>> get_counters(const std::vector<key_T>& keys) const
+	{
+		std::vector<std::optional<std::array<uint64_t, size_T>>> result(keys.size());
 
-		/// @todo: opt
-		std::vector<tCounterId> manager_counter_ids;
-		for (const auto& [key, counter_id] : counters_allocated)
+		std::lock_guard<std::mutex> guard(mutex);
+
+		std::vector<tCounterId> counter_ids;
+		counter_ids.reserve(keys.size() * size_T);
+		for (size_t key_i = 0; key_i < keys.size(); key_i++)
 		{
-			GCC_BUG_UNUSED(key);
+			auto index_it = index.find(keys[key_i]);
+			if (index_it == index.end() ||
+			    slots[index_it->second].state == state_e::inserted)
+			{
+				continue;
+			}
 
-			for (size_t index = 0; index < size_T; index++)
+			const auto counter_id = get_counter_id(index_it->second);
+			for (size_t counter_i = 0; counter_i < size_T; counter_i++)
 			{
-				manager_counter_ids.emplace_back(counter_id + index);
+				counter_ids.emplace_back(counter_id + counter_i);
 			}
-		}
 
-		auto manager_counters = manager->counter_get(manager_counter_ids);
+			result[key_i].emplace();
+		}
 
-		std::map<key_T, std::array<uint64_t, size_T>> result;
+		const auto values = manager->counter_get(counter_ids);
 
-		size_t i = 0;
-		for (const auto& [key, counter_id] : counters_allocated)
+		size_t values_i = 0;
+		for (auto& array : result)
 		{
-			GCC_BUG_UNUSED(counter_id);
-
-			std::array<uint64_t, size_T> array;
-			for (size_t array_i = 0;
-			     array_i < size_T;
-			     array_i++)
+			if (array)
 			{
-				array[array_i] = manager_counters[i * size_T + array_i];
+				std::copy_n(values.begin() + values_i, size_T, array->begin());
+				values_i += size_T;
 			}
-
-			result[key] = array;
-			i++;
 		}
 
 		return result;
 	}
 
+	/// Calls callback(key, values) for allocated counters which changed since `snapshot`,
+	/// then replaces `snapshot` by current values. Empty snapshot reports all counters.
+	template<typename callback_T>
+	void get_counters_delta(snapshot_t& snapshot,
+	                        const callback_T& callback) const
+	{
+		std::lock_guard<std::mutex> guard(mutex);
+
+		const size_t snapshot_size = snapshot.size();
+		snapshot.resize(slots.size());
+
+		for_each_allocated([&](const uint32_t slot_id, const slot_t& slot, const std::array<uint64_t, size_T>& values) {
+			auto& [version, previous_values] = snapshot[slot_id];
+			if (slot_id >= snapshot_size ||
+			    version != slot.version ||
+			    previous_values != values)
+			{
+				callback(slot.key, values);
+				version = slot.version;
+				previous_values = values;
+			}
+		});
+	}
+
 	size_t size() const
 	{
 		std::lock_guard<std::mutex> guard(mutex);
-		return counters_allocated.size();
+		return allocated_count;
 	}
 
 	void gc()
 	{
 		std::lock_guard<std::mutex> guard(mutex);
 
-		if (counters_removed.size())
+		if (slots_removed.size())
 		{
 			uint32_t current_time = time(nullptr);
 
-			for (auto counters_removed_it = counters_removed.begin();
-			     counters_removed_it != counters_removed.end();)
+			for (size_t i = 0; i < slots_removed.size();)
 			{
-				const auto& [key, ids_timestamp] = *counters_removed_it;
-				const auto& [counter_id, timestamp] = ids_timestamp;
+				const auto slot_id = slots_removed[i];
+				auto& slot = slots[slot_id];
 
-				if (current_time >= timestamp)
+				if (current_time >= slot.timestamp)
 				{
-					counters_gc_removed.emplace(key, counter_id);
+					/// last slot of list is moved to position i
+					list_erase(slot_id);
+					slot.state = state_e::gc_removed;
+					list_push(slot_id);
+					continue;
+				}
+
+				i++;
+			}
+		}
+	}
+
+protected:
+	enum class state_e : uint8_t
+	{
+		free,
+		inserted, ///< counter id is reserved
+		allocated,
+		removed, ///< waits for timeout
+		gc_removed, ///< waits for release
+	};
+
+	struct slot_t
+	{
+		key_T key;
+		uint32_t refcount;
+		uint32_t timestamp;
+		uint32_t position; ///< in list of state
+		uint32_t version; ///< incremented on each allocation
+		state_e state;
+	};
+
+	static constexpr uint32_t chunk_slots_size = counter_manager_t::max_buffer_size / size_T;
+	static constexpr uint32_t chunk_size = chunk_slots_size * size_T;
+
+	[[nodiscard]] tCounterId get_counter_id(const uint32_t slot_id) const
+	{
+		const auto chunk_counter_id = chunks[slot_id / chunk_slots_size];
+		if (!chunk_counter_id)
+		{
+			/// fallback
+			return 0;
+		}
+
+		return chunk_counter_id + (slot_id % chunk_slots_size) * size_T;
+	}
+
+	uint32_t slot_acquire()
+	{
+		uint32_t slot_id = slots.size();
+		if (!slots_free.empty())
+		{
+			slot_id = slots_free.back();
+			slots_free.pop_back();
+		}
+		else
+		{
+			if (slot_id % chunk_slots_size == 0)
+			{
+				chunks.emplace_back(0);
+				chunks_used.emplace_back(0);
+			}
+
+			slots.emplace_back();
+		}
+
+		const uint32_t chunk_i = slot_id / chunk_slots_size;
+		if (!chunks[chunk_i])
+		{
+			chunk_reserve(chunk_i);
+		}
+
+		chunks_used[chunk_i]++;
+		return slot_id;
+	}
+
+	void slot_free(const uint32_t slot_id)
+	{
+		auto& slot = slots[slot_id];
+
+		index.erase(slot.key);
+		slot.key = {};
+		slot.state = state_e::free;
+		slots_free.emplace_back(slot_id);
+
+		const uint32_t chunk_i = slot_id / chunk_slots_size;
+		chunks_used[chunk_i]--;
+		if (!chunks_used[chunk_i] &&
+		    chunks[chunk_i])
+		{
+			/// counter ids of empty chunk may serve other modules
+			manager->counter_release(chunks[chunk_i], chunk_size);
+			chunks[chunk_i] = 0;
+		}
+	}
+
+	void chunk_reserve(const uint32_t chunk_i)
+	{
+		chunks[chunk_i] = manager->counter_reserve(chunk_size);
+		if (!chunks[chunk_i])
+		{
+			if (!chunks_used[chunk_i])
+			{
+				YANET_LOG_ERROR("counters are exhausted, fallback is used\n");
+			}
+
+			return;
+		}
+
+		/// slots which used fallback get own counters, starting from zero
+		std::vector<tCounterId> counter_ids;
+		const uint32_t slot_begin = chunk_i * chunk_slots_size;
+		const uint32_t slot_end = std::min((uint32_t)slots.size(), slot_begin + chunk_slots_size);
+		for (uint32_t slot_id = slot_begin; slot_id < slot_end; slot_id++)
+		{
+			auto& slot = slots[slot_id];
+			if (slot.state == state_e::free ||
+			    slot.state == state_e::inserted)
+			{
+				continue;
+			}
+
+			const auto counter_id = get_counter_id(slot_id);
+			for (size_t counter_i = 0; counter_i < size_T; counter_i++)
+			{
+				counter_ids.push_back(counter_id + counter_i);
+			}
+
+			slot.version++;
+		}
+
+		if (!counter_ids.empty())
+		{
+			manager->counter_allocate(counter_ids);
+		}
+	}
+
+	std::vector<uint32_t>& list(const state_e state)
+	{
+		if (state == state_e::inserted)
+		{
+			return slots_inserted;
+		}
+		else if (state == state_e::removed)
+		{
+			return slots_removed;
+		}
+
+		return slots_gc_removed;
+	}
+
+	void list_push(const uint32_t slot_id)
+	{
+		auto& slot = slots[slot_id];
+		auto& slots_list = list(slot.state);
+
+		slot.position = slots_list.size();
+		slots_list.emplace_back(slot_id);
+	}
 
-					counters_removed_it = counters_removed.erase(counters_removed_it);
+	void list_erase(const uint32_t slot_id)
+	{
+		const auto& slot = slots[slot_id];
+		if (slot.state == state_e::free ||
+		    slot.state == state_e::allocated)
+		{
+			return;
+		}
+
+		auto& slots_list = list(slot.state);
+		const auto position = slot.position;
+
+		slots_list[position] = slots_list.back();
+		slots[slots_list[position]].position = position;
+		slots_list.pop_back();
+	}
+
+	/// Calls callback(slot_id, slot, values) for allocated slots, values of chunk are read by one range.
+	template<typename callback_T>
+	void for_each_allocated(const callback_T& callback) const
+	{
+		std::vector<uint64_t> values(chunk_size);
+		std::array<uint64_t, size_T> array;
+
+		for (uint32_t chunk_i = 0; chunk_i < chunks.size(); chunk_i++)
+		{
+			const uint32_t slot_begin = chunk_i * chunk_slots_size;
+			const uint32_t slot_end = std::min((uint32_t)slots.size(), slot_begin + chunk_slots_size);
+
+			bool read = false;
+			for (uint32_t slot_id = slot_begin; slot_id < slot_end; slot_id++)
+			{
+				const auto& slot = slots[slot_id];
+				if (slot.state == state_e::free ||
+				    slot.state == state_e::inserted)
+				{
 					continue;
 				}
 
-				counters_removed_it++;
+				if (!read)
+				{
+					if (chunks[chunk_i])
+					{
+						manager->counter_get_range(chunks[chunk_i], values);
+					}
+					else
+					{
+						std::fill(values.begin(), values.end(), 0);
+					}
+
+					read = true;
+				}
+
+				std::copy_n(values.begin() + (slot_id - slot_begin) * size_T, size_T, array.begin());
+				callback(slot_id, slot, array);
 			}
 		}
 	}
@@ -348,9 +646,68 @@ protected:
 
 	mutable std::mutex mutex;
 
-	std::map<key_T, std::tuple<tCounterId, uint32_t>> counters; ///< refcount
-	std::map<key_T, tCounterId> counters_inserted;
-	std::map<key_T, std::tuple<tCounterId, uint32_t>> counters_removed; ///< timestamp
-	std::map<key_T, tCounterId> counters_gc_removed;
-	std::map<key_T, tCounterId> counters_allocated;
+	std::vector<tCounterId> chunks; ///< first counter id of chunk, zero if not reserved
+	std::vector<uint32_t> chunks_used; ///< not free slots of chunk
+	std::vector<slot_t> slots;
+	std::unordered_map<key_T, uint32_t, counter_hash_t<key_T>> index;
+
+	std::vector<uint32_t> slots_free;
+	std::vector<uint32_t> slots_inserted;
+	std::vector<uint32_t> slots_removed;
+	std::vector<uint32_t> slots_gc_removed;
+
+	size_t allocated_count{};
+};
+
+/// Snapshots of delta readers, each found by the cursor returned to it with the previous response.
+///
+/// Each reader holds one cursor, so up to size_T readers are served independently.
+/// Snapshot of the least recently served reader is dropped first, its next request gets full response.
+template<typename snapshot_T,
+         size_t size_T>
+class delta_cursors_t
+{
+public:
+	using snapshot_t = snapshot_T;
+
+	explicit delta_cursors_t(const uint64_t cursor_first) :
+	        cursor_last(cursor_first)
+	{
+	}
+
+	/// Snapshot of `cursor`, std::nullopt for zero, unknown or dropped cursor.
+	/// Cursor is consumed: repeating it gets std::nullopt.
+	std::optional<snapshot_T> take(const uint64_t cursor)
+	{
+		auto node = snapshots.extract(cursor);
+		if (node.empty())
+		{
+			return std::nullopt;
+		}
+
+		return std::move(node.mapped());
+	}
+
+	/// Stores snapshot, returns cursor for the next request of the reader.
+	uint64_t put(snapshot_T&& snapshot)
+	{
+		if (snapshots.size() >= size_T)
+		{
+			/// cursors grow, so the first one is the least recently served
+			snapshots.erase(snapshots.begin());
+		}
+
+		cursor_last++;
+		snapshots.emplace_hint(snapshots.end(), cursor_last, std::move(snapshot));
+		return cursor_last;
+	}
+
+	[[nodiscard]] size_t size() const
+	{
+		return snapshots.size();
+	}
+
+protected:
+	uint64_t cursor_last;
+	std::map<uint64_t, snapshot_T> snapshots;
 };
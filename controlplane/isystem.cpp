@@ -1,7 +1,13 @@
+#include <cerrno>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <mutex>
+#include <vector>
+
 #include <ifaddrs.h>
+#include <linux/neighbour.h>
+#include <linux/rtnetlink.h>
 #include <linux/sockios.h>
 #include <net/if.h>
 #include <net/if_arp.h>
@@ -15,24 +21,370 @@
 
 using interface::system;
 
-static std::string exec(const char* cmd)
+namespace
+{
+
+/// Persistent rtnetlink socket.
+///
+/// Route requests are packed into one buffer and sent in batches of up to
+/// `batch_size_max` bytes, acknowledgements of a batch are read together.
+class rtnetlink_t
 {
-	std::string result;
+public:
+	constexpr static uint32_t batch_size_max = 32 * 1024;
 
-	FILE* pipe = popen(cmd, "r");
-	if (!pipe)
+	rtnetlink_t()
 	{
-		return "";
+		fd = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+		if (fd < 0)
+		{
+			YANET_LOG_ERROR("rtnetlink: socket(): %s\n", strerror(errno));
+			return;
+		}
+
+		struct timeval timeout = {1, 0};
+		setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+		sockaddr_nl address{};
+		address.nl_family = AF_NETLINK;
+		if (bind(fd, (sockaddr*)&address, sizeof(address)) < 0)
+		{
+			YANET_LOG_ERROR("rtnetlink: bind(): %s\n", strerror(errno));
+			close(fd);
+			fd = -1;
+		}
 	}
 
-	std::array<char, 128> buffer;
-	while (fgets(buffer.data(), buffer.size(), pipe) != nullptr)
+	~rtnetlink_t()
 	{
-		result += buffer.data();
+		if (fd >= 0)
+		{
+			close(fd);
+		}
 	}
 
-	pclose(pipe);
-	return result;
+	static rtnetlink_t& instance()
+	{
+		static rtnetlink_t rtnetlink;
+		return rtnetlink;
+	}
+
+	void route_replace(const ip_prefix_t& prefix,
+	                   const std::set<ip_address_t>& nexthops)
+	{
+		std::vector<ip_address_t> gateways;
+		for (const auto& nexthop : nexthops)
+		{
+			if (nexthop.is_ipv4() == prefix.is_ipv4())
+			{
+				gateways.emplace_back(nexthop);
+			}
+			else
+			{
+				/// @todo: RTA_VIA
+				YANET_LOG_WARNING("rtnetlink: skip nexthop %s of other family for %s\n",
+				                  nexthop.toString().data(),
+				                  prefix.toString().data());
+			}
+		}
+
+		if (gateways.empty())
+		{
+			return;
+		}
+
+		route_begin(RTM_NEWROUTE, NLM_F_CREATE | NLM_F_REPLACE, prefix, RT_SCOPE_UNIVERSE);
+
+		if (gateways.size() == 1)
+		{
+			attr_address(RTA_GATEWAY, gateways[0]);
+		}
+		else
+		{
+			size_t multipath = nest_begin(RTA_MULTIPATH, sizeof(rtattr));
+			for (const auto& gateway : gateways)
+			{
+				size_t nexthop = nest_begin(0, sizeof(rtnexthop));
+				attr_address(RTA_GATEWAY, gateway);
+				nest_end(nexthop);
+			}
+			nest_end(multipath);
+		}
+
+		message_end(prefix);
+	}
+
+	void route_remove(const ip_prefix_t& prefix)
+	{
+		route_begin(RTM_DELROUTE, 0, prefix, RT_SCOPE_NOWHERE);
+		message_end(prefix);
+	}
+
+	/// Sends requests which are not sent yet and waits for their acknowledgements.
+	void flush()
+	{
+		if (batch.empty())
+		{
+			return;
+		}
+
+		if (fd >= 0 &&
+		    send(fd, batch.data(), batch.size(), 0) < 0)
+		{
+			YANET_LOG_ERROR("rtnetlink: send(): %s\n", strerror(errno));
+		}
+		else if (fd >= 0)
+		{
+			receive([this](const nlmsghdr* header) {
+				const uint32_t index = header->nlmsg_seq - batch_seq;
+				if (header->nlmsg_type == NLMSG_ERROR &&
+				    index < batch_prefixes.size()) ///< late acks of previous requests are skipped
+				{
+					const auto* error = (const nlmsgerr*)NLMSG_DATA(header);
+					if (error->error)
+					{
+						YANET_LOG_WARNING("rtnetlink: %s: %s\n",
+						                  batch_prefixes[index].toString().data(),
+						                  strerror(-error->error));
+					}
+
+					batch_acks--;
+				}
+				return batch_acks != 0;
+			});
+		}
+
+		batch.clear();
+		batch_prefixes.clear();
+		batch_acks = 0;
+	}
+
+	std::optional<mac_address_t> neighbor_lookup(const ipv6_address_t& address,
+	                                             const unsigned int ifindex)
+	{
+		flush();
+
+		struct
+		{
+			nlmsghdr header;
+			ndmsg neighbor;
+			uint8_t attributes[RTA_SPACE(16)];
+		} request{};
+		request.header.nlmsg_len = NLMSG_LENGTH(sizeof(ndmsg));
+		request.header.nlmsg_type = RTM_GETNEIGH;
+		request.header.nlmsg_flags = NLM_F_REQUEST;
+		request.header.nlmsg_seq = ++seq;
+		request.neighbor.ndm_family = AF_INET6;
+		request.neighbor.ndm_ifindex = ifindex;
+
+		if (ifindex)
+		{
+			/// kernel returns the one entry, lookup by NDA_DST requires a device
+			auto* attribute = (rtattr*)((char*)&request + NLMSG_ALIGN(request.header.nlmsg_len));
+			attribute->rta_type = NDA_DST;
+			attribute->rta_len = RTA_LENGTH(16);
+			memcpy(RTA_DATA(attribute), address.data(), 16);
+			request.header.nlmsg_len = NLMSG_ALIGN(request.header.nlmsg_len) + RTA_LENGTH(16);
+		}
+		else
+		{
+			/// without interface, neighbors of all interfaces are dumped and filtered here
+			request.header.nlmsg_flags |= NLM_F_DUMP;
+		}
+
+		if (fd < 0 ||
+		    send(fd, &request, request.header.nlmsg_len, 0) < 0)
+		{
+			return std::nullopt;
+		}
+
+		std::optional<mac_address_t> result;
+		receive([&](const nlmsghdr* header) {
+			if (header->nlmsg_seq != request.header.nlmsg_seq)
+			{
+				/// late reply of previous request
+				return true;
+			}
+
+			if (header->nlmsg_type == NLMSG_DONE ||
+			    header->nlmsg_type == NLMSG_ERROR)
+			{
+				return false;
+			}
+
+			const auto* neighbor = (const ndmsg*)NLMSG_DATA(header);
+			if (result ||
+			    header->nlmsg_type != RTM_NEWNEIGH)
+			{
+				return true;
+			}
+
+			const uint8_t* destination = nullptr;
+			const uint8_t* lladdr = nullptr;
+
+			int length = RTM_PAYLOAD(header);
+			for (auto* attribute = (const rtattr*)((const char*)neighbor + NLMSG_ALIGN(sizeof(ndmsg)));
+			     RTA_OK(attribute, length);
+			     attribute = RTA_NEXT(attribute, length))
+			{
+				if (attribute->rta_type == NDA_DST && RTA_PAYLOAD(attribute) == 16)
+				{
+					destination = (const uint8_t*)RTA_DATA(attribute);
+				}
+				else if (attribute->rta_type == NDA_LLADDR && RTA_PAYLOAD(attribute) == 6)
+				{
+					lladdr = (const uint8_t*)RTA_DATA(attribute);
+				}
+			}
+
+			if (destination && lladdr &&
+			    memcmp(destination, address.data(), 16) == 0)
+			{
+				result = mac_address_t(lladdr);
+			}
+
+			/// reply to a lookup is one message without NLMSG_DONE
+			return !ifindex;
+		});
+
+		return result;
+	}
+
+public:
+	std::mutex mutex;
+
+protected:
+	void route_begin(const uint16_t type,
+	                 const uint16_t flags,
+	                 const ip_prefix_t& prefix,
+	                 const uint8_t scope)
+	{
+		if (batch.size() >= batch_size_max)
+		{
+			flush();
+		}
+
+		if (batch.empty())
+		{
+			batch_seq = seq + 1;
+		}
+
+		message = batch.size();
+		batch.resize(message + NLMSG_SPACE(sizeof(rtmsg)), 0);
+
+		auto* header = (nlmsghdr*)&batch[message];
+		header->nlmsg_len = NLMSG_LENGTH(sizeof(rtmsg));
+		header->nlmsg_type = type;
+		header->nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK | flags;
+		header->nlmsg_seq = ++seq;
+
+		auto* route = (rtmsg*)NLMSG_DATA(header);
+		route->rtm_family = prefix.is_ipv4() ? AF_INET : AF_INET6;
+		route->rtm_dst_len = prefix.mask();
+		route->rtm_table = RT_TABLE_MAIN;
+		route->rtm_protocol = RTPROT_BOOT;
+		route->rtm_scope = scope;
+		route->rtm_type = RTN_UNICAST;
+
+		attr_address(RTA_DST, prefix.address());
+	}
+
+	void message_end(const ip_prefix_t& prefix)
+	{
+		batch_prefixes.emplace_back(prefix);
+		batch_acks++;
+	}
+
+	void attr(const uint16_t type, const void* data, const uint16_t size)
+	{
+		size_t offset = batch.size();
+		batch.resize(offset + RTA_SPACE(size), 0);
+
+		auto* attribute = (rtattr*)&batch[offset];
+		attribute->rta_type = type;
+		attribute->rta_len = RTA_LENGTH(size);
+		memcpy(RTA_DATA(attribute), data, size);
+
+		((nlmsghdr*)&batch[message])->nlmsg_len = batch.size() - message;
+	}
+
+	void attr_address(const uint16_t type, const ip_address_t& address)
+	{
+		if (address.is_ipv4())
+		{
+			uint32_t ipv4_address = htonl(address.get_ipv4());
+			attr(type, &ipv4_address, sizeof(ipv4_address));
+		}
+		else
+		{
+			attr(type, address.get_ipv6().data(), 16);
+		}
+	}
+
+	/// rtattr and rtnexthop both start with uint16_t length
+	size_t nest_begin(const uint16_t type, const size_t header_size)
+	{
+		size_t offset = batch.size();
+		batch.resize(offset + header_size, 0);
+
+		if (header_size == sizeof(rtattr))
+		{
+			((rtattr*)&batch[offset])->rta_type = type;
+		}
+
+		return offset;
+	}
+
+	void nest_end(const size_t offset)
+	{
+		*(uint16_t*)&batch[offset] = batch.size() - offset;
+		((nlmsghdr*)&batch[message])->nlmsg_len = batch.size() - message;
+	}
+
+	/// Reads messages while handler returns true.
+	template<typename handler_t>
+	void receive(const handler_t& handler)
+	{
+		std::vector<uint8_t> buffer(64 * 1024);
+
+		for (;;)
+		{
+			ssize_t size = recv(fd, buffer.data(), buffer.size(), 0);
+			if (size < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				YANET_LOG_ERROR("rtnetlink: recv(): %s\n", strerror(errno));
+				return;
+			}
+
+			int length = size;
+			for (auto* header = (const nlmsghdr*)buffer.data();
+			     NLMSG_OK(header, length);
+			     header = NLMSG_NEXT(header, length))
+			{
+				if (!handler(header))
+				{
+					return;
+				}
+			}
+		}
+	}
+
+protected:
+	int fd{-1};
+	uint32_t seq{};
+
+	std::vector<uint8_t> batch;
+	size_t message{}; ///< offset of last message in batch
+	uint32_t batch_seq{}; ///< seq of first message in batch
+	uint32_t batch_acks{};
+	std::vector<ip_prefix_t> batch_prefixes;
+};
+
 }
 
 bool system::getEtherAddress(const uint32_t& ipAddress,
@@ -108,34 +460,38 @@ bool system::getEtherAddress(const std::string& interfaceName,
                              const ipv6_address_t& ipv6Address,
                              mac_address_t& etherAddress)
 {
-	/// @todo: netlink
+	unsigned int ifindex = if_nametoindex(interfaceName.data());
+	if (!ifindex)
+	{
+		return false;
+	}
 
-	char buffer[1024];
-	snprintf(buffer, sizeof(buffer), "ip -6 neighbour show to %s dev %s | cut -d' ' -f3", ipv6Address.toString().data(), interfaceName.data());
+	auto& rtnetlink = rtnetlink_t::instance();
+	std::lock_guard<std::mutex> guard(rtnetlink.mutex);
 
-	etherAddress = exec(buffer);
-	if (etherAddress.is_default())
+	auto neighbor = rtnetlink.neighbor_lookup(ipv6Address, ifindex);
+	if (!neighbor || neighbor->is_default())
 	{
 		return false;
 	}
 
+	etherAddress = *neighbor;
 	return true;
 }
 
 bool system::getEtherAddress(const ipv6_address_t& ipv6Address,
                              mac_address_t& etherAddress)
 {
-	/// @todo: netlink
-
-	char buffer[1024];
-	snprintf(buffer, sizeof(buffer), "ip -6 neighbour show to %s | cut -d' ' -f5", ipv6Address.toString().data());
+	auto& rtnetlink = rtnetlink_t::instance();
+	std::lock_guard<std::mutex> guard(rtnetlink.mutex);
 
-	etherAddress = exec(buffer);
-	if (etherAddress.is_default())
+	auto neighbor = rtnetlink.neighbor_lookup(ipv6Address, 0);
+	if (!neighbor || neighbor->is_default())
 	{
 		return false;
 	}
 
+	etherAddress = *neighbor;
 	return true;
 }
 
@@ -166,73 +522,62 @@ void system::updateRoute(const uint32_t& network,
                          const uint8_t& mask,
                          const std::set<uint32_t>& nexthops)
 {
-	/// @todo: netlink
-
-	ipv4_prefix_t prefix = {network, mask};
-
-	char buffer[1024];
-	snprintf(buffer, sizeof(buffer), "ip route replace %s", prefix.toString().data());
-
+	std::set<ip_address_t> l_nexthops;
 	for (const auto& nexthop : nexthops)
 	{
-		snprintf(buffer + strlen(buffer), sizeof(buffer) - strlen(buffer), " nexthop via %s", ipv4_address_t(nexthop).toString().data());
+		l_nexthops.emplace(ipv4_address_t(nexthop));
 	}
 
-	[[maybe_unused]] int ret = ::system(buffer);
+	updateRoute(ipv4_prefix_t(network, mask), l_nexthops);
 }
 
 void system::updateRoute(const ip_prefix_t& prefix,
                          const std::set<ip_address_t>& nexthops)
 {
-	if (prefix.is_ipv4())
-	{
-		std::set<uint32_t> l_nexthops;
-		for (const auto& nexthop : nexthops)
-		{
-			if (nexthop.is_ipv4())
-			{
-				l_nexthops.emplace(nexthop.get_ipv4());
-			}
-			else
-			{
-				/// @todo
-			}
-		}
+	auto& rtnetlink = rtnetlink_t::instance();
+	std::lock_guard<std::mutex> guard(rtnetlink.mutex);
 
-		updateRoute(prefix.get_ipv4().address(),
-		            prefix.get_ipv4().mask(),
-		            l_nexthops);
-	}
-	else
+	rtnetlink.route_replace(prefix, nexthops);
+	rtnetlink.flush();
+}
+
+void system::updateRoutes(const std::map<ip_prefix_t, std::set<ip_address_t>>& routes)
+{
+	auto& rtnetlink = rtnetlink_t::instance();
+	std::lock_guard<std::mutex> guard(rtnetlink.mutex);
+
+	for (const auto& [prefix, nexthops] : routes)
 	{
-		/// @todo
+		rtnetlink.route_replace(prefix, nexthops);
 	}
+	rtnetlink.flush();
 }
 
 void system::removeRoute(const uint32_t& network,
                          const uint8_t& mask)
 {
-	/// @todo: netlink
-
-	ipv4_prefix_t prefix = {network, mask};
+	removeRoute(ipv4_prefix_t(network, mask));
+}
 
-	char buffer[512];
-	snprintf(buffer, sizeof(buffer), "ip route del %s", prefix.toString().data());
+void system::removeRoute(const ip_prefix_t& prefix)
+{
+	auto& rtnetlink = rtnetlink_t::instance();
+	std::lock_guard<std::mutex> guard(rtnetlink.mutex);
 
-	[[maybe_unused]] int ret = ::system(buffer);
+	rtnetlink.route_remove(prefix);
+	rtnetlink.flush();
 }
 
-void system::removeRoute(const ip_prefix_t& prefix)
+void system::removeRoutes(const std::set<ip_prefix_t>& prefixes)
 {
-	if (prefix.is_ipv4())
-	{
-		removeRoute(prefix.get_ipv4().address(),
-		            prefix.get_ipv4().mask());
-	}
-	else
+	auto& rtnetlink = rtnetlink_t::instance();
+	std::lock_guard<std::mutex> guard(rtnetlink.mutex);
+
+	for (const auto& prefix : prefixes)
 	{
-		/// @todo
+		rtnetlink.route_remove(prefix);
 	}
+	rtnetlink.flush();
 }
 
 std::set<uint32_t> system::getLocalIpAddresses()
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <map>
 #include <set>
 #include <string>
 
@@ -18,8 +19,12 @@ public:
 	static std::optional<mac_address_t> getMacAddress(const std::string& interfaceName, const ip_address_t& address);
 	static void updateRoute(const uint32_t& network, const uint8_t& mask, const std::set<uint32_t>& nexthops);
 	static void updateRoute(const ip_prefix_t& prefix, const std::set<ip_address_t>& nexthops);
+	/// replaces all routes by batched rtnetlink requests
+	static void updateRoutes(const std::map<ip_prefix_t, std::set<ip_address_t>>& routes);
 	static void removeRoute(const uint32_t& network, const uint8_t& mask);
 	static void removeRoute(const ip_prefix_t& prefix);
+	/// removes routes by batched rtnetlink requests
+	static void removeRoutes(const std::set<ip_prefix_t>& prefixes);
 	static std::set<uint32_t> getLocalIpAddresses();
 	static std::set<std::array<uint8_t, 16>> getLocalIPv6Addresses();
 	static std::optional<mac_address_t> get_mac_address(const std::string& vrf, const ip_address_t& address);
@@ -1003,10 +1003,7 @@ void route_t::reload(const controlplane::base_t& base_prev,
 
 #ifdef CONFIG_YADECAP_AUTOTEST
 #else // CONFIG_YADECAP_AUTOTEST
-	for (const auto& [prefix, route] : linux_routes)
-	{
-		system.updateRoute(prefix, route); ///< @todo: unlock
-	}
+	system.updateRoutes(linux_routes); ///< @todo: unlock
 #endif // CONFIG_YADECAP_AUTOTEST
 
 	tunnel_counter.allocate();
@@ -244,12 +244,9 @@ private:
 				return error_in_block_;
 			}
 
-			// set bits usage
+			// set bits usage, group has a free segment now
 			DISABLE_BIT(masks[group], index);
-			if (masks[group] == 0)
-			{
-				DISABLE_BIT(group_mask, group);
-			}
+			DISABLE_BIT(group_mask, group);
 
 			// change number of free segments
 			free_segments++;
@@ -47,7 +47,8 @@ static inline double calcUsage(const std::array<uint64_t, CONFIG_YADECAP_MBUFS_B
 }
 
 telegraf_t::telegraf_t() :
-        flagFirst(true)
+        flagFirst(true),
+        mappings_delta_cursors((uint64_t)time(nullptr) << 32) ///< cursors of previous process are not accepted
 {
 }
 
@@ -77,6 +78,10 @@ eResult telegraf_t::init()
 		return telegraf_mappings();
 	});
 
+	controlPlane->register_command(common::icp::requestType::telegraf_mappings_delta, [this](const common::icp::request& request) {
+		return telegraf_mappings_delta(std::get<common::icp::telegraf_mappings_delta::request>(std::get<1>(request)));
+	});
+
 	return eResult::success;
 }
 
@@ -183,6 +188,41 @@ common::icp::telegraf_mappings::response telegraf_t::telegraf_mappings()
 	return response;
 }
 
+common::icp::telegraf_mappings_delta::response telegraf_t::telegraf_mappings_delta(const common::icp::telegraf_mappings_delta::request& request)
+{
+	const auto& cursor = request;
+
+	common::icp::telegraf_mappings_delta::response response;
+	auto& [response_cursor, response_flag_full, response_mappings] = response;
+
+	/// unknown cursor: first request, caller missed previous response
+	/// or was not served for longer than other mappings_delta_readers_size readers
+	std::optional<decltype(mappings_delta_cursors)::snapshot_t> snapshot;
+	{
+		std::lock_guard<std::mutex> guard(mappings_delta_mutex);
+		snapshot = mappings_delta_cursors.take(cursor);
+	}
+
+	response_flag_full = !snapshot;
+	if (response_flag_full)
+	{
+		snapshot.emplace();
+	}
+
+	controlPlane->tun64.mappings_counters.get_counters_delta(*snapshot, [&](const auto& key, const auto& values) {
+		const auto& [name, ipv4_address] = key;
+		const auto& [encap_packets, encap_bytes, decap_packets, decap_bytes] = values;
+		response_mappings.emplace_back(name, ipv4_address, common::tun64mapping::stats_t{encap_packets, encap_bytes, decap_packets, decap_bytes});
+	});
+
+	{
+		std::lock_guard<std::mutex> guard(mappings_delta_mutex);
+		response_cursor = mappings_delta_cursors.put(std::move(*snapshot));
+	}
+
+	return response;
+}
+
 common::icp::telegraf_dregress::response telegraf_t::telegraf_dregress()
 {
 	auto& dataPlane = dataPlaneDregress;
@@ -1,11 +1,13 @@
 #pragma once
 
 #include <map>
+#include <mutex>
 
 #include "common/icp.h"
 #include "common/idataplane.h"
 #include "common/idp.h"
 
+#include "counter.h"
 #include "module.h"
 #include "route.h"
 #include "type.h"
@@ -73,6 +75,7 @@ public:
 	/// @todo: common::icp::telegraf_balancer_real::response telegraf_balancer_real();
 	common::icp::telegraf_other::response telegraf_other();
 	common::icp::telegraf_mappings::response telegraf_mappings();
+	common::icp::telegraf_mappings_delta::response telegraf_mappings_delta(const common::icp::telegraf_mappings_delta::request& request);
 
 protected:
 	interface::dataPlane dataPlaneUnsafe;
@@ -87,4 +90,12 @@ protected:
 
 	std::map<std::tuple<bool, uint32_t, common::ip_address_t>, std::array<common::uint64, 2>> route_tunnel_peer_counters; ///< @todo: gc
 	std::map<route::tunnel_counter_key_t, std::array<uint64_t, 2>> dregress_traffic_counters_prev;
+
+	/// telegraf exec instances (or other scrapers) polling tun64 mapping deltas in parallel
+	constexpr static size_t mappings_delta_readers_size = 8;
+
+	std::mutex mappings_delta_mutex;
+	delta_cursors_t<counter_t<std::tuple<std::string, common::ipv4_address_t>, 4>::snapshot_t,
+	                mappings_delta_readers_size>
+	        mappings_delta_cursors;
 };
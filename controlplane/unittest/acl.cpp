@@ -695,4 +695,43 @@ add hitcount SomeRandomString123 ip from any to any
 	});
 }
 
+TEST_F(ACL, RateLimit_Basic)
+{
+	compile_acl(R"IPFW(
+:BEGIN
+add rate-limit syn_flood 1000 1000 ip from 10.0.0.0/8 to any
+add rate-limit syn_flood 1000 1000 ip from 11.0.0.0/8 to any
+add rate-limit dns 500 100 udp from any to any 53
+add allow ip from any to any
+)IPFW");
+
+	ASSERT_EQ(result.acl_meters.size(), 2);
+	EXPECT_EQ(result.acl_meters[0], std::make_tuple(1000u, 1000u));
+	EXPECT_EQ(result.acl_meters[1], std::make_tuple(500u, 100u));
+
+	std::set<uint32_t> meter_ids;
+	visit_actions([&](const auto& actions) {
+		for (size_t i = 0; i < actions.default_path_size(); i++)
+		{
+			const auto& raw_action = actions.default_path_raw_action(i);
+			if (const auto* rate_limit_action = std::get_if<common::RateLimitAction>(&raw_action))
+			{
+				meter_ids.emplace(rate_limit_action->meter_id);
+			}
+		}
+	});
+
+	EXPECT_EQ(meter_ids, (std::set<uint32_t>{0, 1}));
+}
+
+TEST_F(ACL, RateLimit_Redefined)
+{
+	EXPECT_ANY_THROW(compile_acl(R"IPFW(
+:BEGIN
+add rate-limit syn_flood 1000 1000 ip from 10.0.0.0/8 to any
+add rate-limit syn_flood 1000 2000 ip from 11.0.0.0/8 to any
+add allow ip from any to any
+)IPFW"));
+}
+
 } // namespace
@@ -0,0 +1,219 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "../acl_compiler.h"
+#include "common/stream.h"
+
+namespace
+{
+
+using common::uint128_t;
+
+acl::rule_t make_rule(const std::string& source,
+                      const std::string& destination,
+                      const uint32_t id)
+{
+	acl::ref_t<acl::filter_network_t> filter_source = new acl::filter_network_t(source);
+	acl::ref_t<acl::filter_network_t> filter_destination = new acl::filter_network_t(destination);
+	acl::ref_t<acl::filter_id_t> filter_acl_id = new acl::filter_id_t(1);
+	acl::ref_t<acl::filter_t> filter = new acl::filter_t(filter_acl_id, filter_source, filter_destination, {}, {}, {}, {});
+
+	common::globalBase::tFlow flow{};
+	flow.type = common::globalBase::eFlowType::route;
+
+	return acl::rule_t(filter, flow, {id}, false);
+}
+
+/// rules over few prefixes: many source and destination group ids share rows and columns of network table
+std::vector<acl::rule_t> make_rules(std::mt19937& random,
+                                    const uint32_t rules_count)
+{
+	std::vector<std::string> ipv4_prefixes;
+	std::vector<std::string> ipv6_prefixes;
+	for (unsigned int i = 0; i < 24; i++)
+	{
+		ipv4_prefixes.emplace_back("10." + std::to_string(i % 6) + "." + std::to_string(i) + ".0/" + std::to_string(16 + i % 3 * 4));
+		ipv6_prefixes.emplace_back("2001:db8:" + std::to_string(i % 6) + ":" + std::to_string(i) + "::/" + std::to_string(48 + i % 3 * 8));
+	}
+
+	std::vector<acl::rule_t> rules;
+	for (uint32_t rule_id = 0; rule_id < rules_count; rule_id++)
+	{
+		const auto& prefixes = rule_id % 4 ? ipv4_prefixes : ipv6_prefixes;
+		rules.emplace_back(make_rule(prefixes[random() % prefixes.size()],
+		                             prefixes[random() % prefixes.size()],
+		                             rule_id));
+	}
+
+	return rules;
+}
+
+template<typename type_t>
+std::vector<type_t> make_addresses(std::mt19937& random,
+                                   const std::vector<acl::rule_t>& rules,
+                                   const uint8_t family)
+{
+	std::vector<type_t> addresses;
+	for (const auto& rule : rules)
+	{
+		for (const auto* filter : {rule.filter->src.filter, rule.filter->dst.filter})
+		{
+			for (const auto& network : filter->networks)
+			{
+				if (network.family == family)
+				{
+					addresses.emplace_back((type_t)network.addr);
+					addresses.emplace_back((type_t)(network.addr | ~network.mask));
+				}
+			}
+		}
+	}
+
+	for (unsigned int i = 0; i < 1024; i++)
+	{
+		type_t address = 0;
+		for (unsigned int word_i = 0; word_i < sizeof(type_t) / sizeof(uint32_t); word_i++)
+		{
+			address = (type_t)(((uint128_t)address << 32) | random());
+		}
+		addresses.emplace_back(address);
+	}
+
+	return addresses;
+}
+
+class network_table_snapshot_t
+{
+public:
+	network_table_snapshot_t(const acl::compiler_t& compiler) :
+	        ipv4_source(compiler.network_ipv4_source.tree),
+	        ipv4_destination(compiler.network_ipv4_destination.tree),
+	        ipv6_source(compiler.network_ipv6_source.tree),
+	        ipv6_destination(compiler.network_ipv6_destination.tree),
+	        width(compiler.network_table.width),
+	        values(compiler.network_table.table.values())
+	{
+	}
+
+	tAclGroupId lookup_ipv4(const uint32_t source, const uint32_t destination)
+	{
+		return values[ipv4_source.lookup(source) * width + ipv4_destination.lookup(destination)];
+	}
+
+	tAclGroupId lookup_ipv6(const uint128_t& source, const uint128_t& destination)
+	{
+		return values[ipv6_source.lookup(source) * width + ipv6_destination.lookup(destination)];
+	}
+
+public:
+	decltype(acl::compiler_t::network_ipv4_source.tree) ipv4_source;
+	decltype(acl::compiler_t::network_ipv4_destination.tree) ipv4_destination;
+	decltype(acl::compiler_t::network_ipv6_source.tree) ipv6_source;
+	decltype(acl::compiler_t::network_ipv6_destination.tree) ipv6_destination;
+	uint32_t width;
+	std::vector<tAclGroupId> values;
+};
+
+TEST(ACLCompiler, NetworkTableCompress)
+{
+	std::mt19937 random(1);
+	const auto rules = make_rules(random, 256);
+
+	acl::compiler_t compiler;
+	compiler.clear();
+	compiler.collect(rules);
+	compiler.network_compile();
+
+	compiler.network_table.prepare(compiler.source_group_id, compiler.destination_group_id);
+	compiler.network_table.compile();
+	compiler.network_table.populate();
+
+	/// every group id of this ruleset has its own row and column, make some of them equal
+	auto& table = compiler.network_table;
+	auto& values = table.table.values();
+	for (uint32_t row = 3; row < compiler.source_group_id; row += 3)
+	{
+		std::copy_n(values.begin() + (row - 2) * table.width, table.width, values.begin() + row * table.width);
+	}
+	for (uint32_t row = 0; row < compiler.source_group_id; row++)
+	{
+		for (uint32_t column = 4; column < compiler.destination_group_id; column += 4)
+		{
+			values[row * table.width + column] = values[row * table.width + column - 1];
+		}
+	}
+
+	network_table_snapshot_t before(compiler);
+	compiler.network_table.compress();
+	network_table_snapshot_t after(compiler);
+
+	EXPECT_LT(after.values.size(), before.values.size());
+
+	const auto ipv4_addresses = make_addresses<uint32_t>(random, rules, 4);
+	for (const auto source : ipv4_addresses)
+	{
+		for (const auto destination : ipv4_addresses)
+		{
+			ASSERT_EQ(before.lookup_ipv4(source, destination), after.lookup_ipv4(source, destination));
+		}
+	}
+
+	const auto ipv6_addresses = make_addresses<uint128_t>(random, rules, 6);
+	for (const auto& source : ipv6_addresses)
+	{
+		for (const auto& destination : ipv6_addresses)
+		{
+			ASSERT_EQ(before.lookup_ipv6(source, destination), after.lookup_ipv6(source, destination));
+		}
+	}
+}
+
+template<typename type_t>
+std::vector<uint8_t> serialize(const type_t& value)
+{
+	common::stream_out_t stream;
+	stream.push(value);
+	return stream.getBuffer();
+}
+
+TEST(ACLCompiler, NetworkParallel)
+{
+	std::mt19937 random(2);
+	const auto rules = make_rules(random, 2048);
+
+	acl::result_t results[2];
+	for (bool network_parallel : {false, true})
+	{
+		acl::compiler_t compiler;
+		compiler.network_parallel = network_parallel;
+		compiler.compile(rules, results[network_parallel]);
+	}
+
+	const auto& [serial, parallel] = results;
+	EXPECT_EQ(serialize(serial.acl_network_ipv4_source), serialize(parallel.acl_network_ipv4_source));
+	EXPECT_EQ(serialize(serial.acl_network_ipv4_destination), serialize(parallel.acl_network_ipv4_destination));
+	EXPECT_EQ(serialize(serial.acl_network_ipv6_source), serialize(parallel.acl_network_ipv6_source));
+	EXPECT_EQ(serialize(serial.acl_network_ipv6_destination_ht), serialize(parallel.acl_network_ipv6_destination_ht));
+	EXPECT_EQ(serialize(serial.acl_network_ipv6_destination), serialize(parallel.acl_network_ipv6_destination));
+	EXPECT_EQ(serialize(serial.acl_network_table), serialize(parallel.acl_network_table));
+	EXPECT_EQ(serialize(serial.acl_network_flags), serialize(parallel.acl_network_flags));
+	EXPECT_EQ(serialize(serial.acl_transport_layers), serialize(parallel.acl_transport_layers));
+	EXPECT_EQ(serialize(serial.acl_transport_tables), serialize(parallel.acl_transport_tables));
+	EXPECT_EQ(serialize(serial.acl_total_table), serialize(parallel.acl_total_table));
+
+	/// serialized actions hold unset bytes of empty std::optional
+	ASSERT_EQ(serial.acl_values.size(), parallel.acl_values.size());
+	for (size_t value_i = 0; value_i < serial.acl_values.size(); value_i++)
+	{
+		ASSERT_EQ(serial.acl_values[value_i].index(), parallel.acl_values[value_i].index());
+		std::visit([&](const auto& serial_actions) {
+			const auto& parallel_actions = std::get<std::decay_t<decltype(serial_actions)>>(parallel.acl_values[value_i]);
+			EXPECT_EQ(serial_actions.default_path_size(), parallel_actions.default_path_size());
+			EXPECT_EQ(serial_actions.get_flow(), parallel_actions.get_flow());
+		},
+		           serial.acl_values[value_i]);
+	}
+}
+
+}
@@ -0,0 +1,234 @@
+#include <gtest/gtest.h>
+
+#include "controlplane/counter.h"
+
+using counter_key_t = std::tuple<std::string, uint32_t>;
+using counter = counter_t<counter_key_t, 4>;
+
+TEST(Counter, Delta)
+{
+	std::vector<uint64_t> worker_buffers[2] = {std::vector<uint64_t>(YANET_CONFIG_COUNTERS_SIZE),
+	                                           std::vector<uint64_t>(YANET_CONFIG_COUNTERS_SIZE)};
+
+	common::sdp::DataPlaneInSharedMemory sdp_data;
+	sdp_data.metadata_worker.start_counters = 0;
+	sdp_data.workers[1].buffer = worker_buffers[0].data();
+	sdp_data.workers[2].buffer = worker_buffers[1].data();
+
+	counter_manager_t manager;
+	manager.init(&sdp_data);
+
+	counter counters;
+	counters.init(&manager);
+	for (uint32_t i = 0; i < 1000; i++)
+	{
+		counters.insert({"tunnel", i});
+	}
+	counters.allocate();
+
+	counter::snapshot_t snapshot;
+	uint32_t changed = 0;
+	auto count = [&](const counter_key_t& key, const std::array<uint64_t, 4>& values) {
+		GCC_BUG_UNUSED(key);
+		GCC_BUG_UNUSED(values);
+		changed++;
+	};
+
+	/// empty snapshot: all counters
+	counters.get_counters_delta(snapshot, count);
+	EXPECT_EQ(1000u, changed);
+
+	changed = 0;
+	counters.get_counters_delta(snapshot, count);
+	EXPECT_EQ(0u, changed);
+
+	const auto counter_id = counters.get_id({"tunnel", 7});
+	worker_buffers[0][counter_id + 2] += 5;
+	worker_buffers[1][counter_id + 2] += 3;
+
+	changed = 0;
+	counters.get_counters_delta(snapshot, [&](const counter_key_t& key, const std::array<uint64_t, 4>& values) {
+		EXPECT_EQ(counter_key_t("tunnel", 7), key);
+		EXPECT_EQ((std::array<uint64_t, 4>{0, 0, 8, 0}), values);
+		changed++;
+	});
+	EXPECT_EQ(1u, changed);
+	EXPECT_EQ(8u, counters.get_counters().at({"tunnel", 7})[2]);
+
+	for (uint32_t i = 0; i < 500; i++)
+	{
+		counters.remove({"tunnel", i});
+	}
+	counters.gc();
+	counters.release();
+
+	changed = 0;
+	counters.get_counters_delta(snapshot, count);
+	EXPECT_EQ(0u, changed);
+	EXPECT_EQ(500u, counters.size());
+
+	/// freed slots are reused by new keys
+	for (uint32_t i = 0; i < 10; i++)
+	{
+		counters.insert({"other", i});
+	}
+	counters.allocate();
+
+	changed = 0;
+	counters.get_counters_delta(snapshot, count);
+	EXPECT_EQ(10u, changed);
+}
+
+TEST(Counter, Slots)
+{
+	std::vector<uint64_t> worker_buffer(YANET_CONFIG_COUNTERS_SIZE);
+
+	common::sdp::DataPlaneInSharedMemory sdp_data;
+	sdp_data.metadata_worker.start_counters = 0;
+	sdp_data.workers[1].buffer = worker_buffer.data();
+
+	counter_manager_t manager;
+	manager.init(&sdp_data);
+
+	counter counters;
+	counters.init(&manager);
+	counters.insert({"a", 1});
+	counters.insert({"a", 2});
+	counters.insert({"a", 3});
+
+	/// not allocated yet, counter id is released at once
+	counters.remove({"a", 3});
+	counters.allocate();
+	EXPECT_EQ(2u, counters.size());
+
+	const auto counter_id = counters.get_id({"a", 1});
+	EXPECT_NE(0u, counter_id);
+	EXPECT_EQ(counter_id + 4, counters.get_id({"a", 2}));
+	EXPECT_EQ(0u, counters.get_id({"a", 3}));
+
+	worker_buffer[counter_id + 4] = 7;
+	const auto values = counters.get_counters({{"a", 2}, {"a", 3}});
+	ASSERT_EQ(2u, values.size());
+	ASSERT_TRUE(values[0].has_value());
+	EXPECT_EQ((std::array<uint64_t, 4>{7, 0, 0, 0}), *values[0]);
+	EXPECT_FALSE(values[1].has_value());
+
+	/// insert cancels removing
+	counters.remove({"a", 1});
+	counters.insert({"a", 1});
+	counters.gc();
+	counters.release();
+	EXPECT_EQ(counter_id, counters.get_id({"a", 1}));
+	EXPECT_EQ(2u, counters.get_counters().size());
+}
+
+TEST(Counter, DeltaCursors)
+{
+	delta_cursors_t<std::vector<int>, 2> cursors(100);
+
+	EXPECT_FALSE(cursors.take(0));
+
+	const auto cursor_a = cursors.put({1});
+	const auto cursor_b = cursors.put({2});
+	EXPECT_NE(cursor_a, cursor_b);
+
+	/// readers do not invalidate each other
+	EXPECT_EQ(std::vector<int>{1}, cursors.take(cursor_a));
+	const auto cursor_a_next = cursors.put({3});
+	EXPECT_EQ(std::vector<int>{2}, cursors.take(cursor_b));
+	const auto cursor_b_next = cursors.put({4});
+
+	/// consumed cursor
+	EXPECT_FALSE(cursors.take(cursor_a));
+
+	/// third reader evicts the least recently served one
+	cursors.put({5});
+	EXPECT_EQ(2u, cursors.size());
+	EXPECT_FALSE(cursors.take(cursor_a_next));
+	EXPECT_EQ(std::vector<int>{4}, cursors.take(cursor_b_next));
+}
+
+TEST(Counter, ChunkRelease)
+{
+	std::vector<uint64_t> worker_buffer(YANET_CONFIG_COUNTERS_SIZE);
+
+	common::sdp::DataPlaneInSharedMemory sdp_data;
+	sdp_data.metadata_worker.start_counters = 0;
+	sdp_data.workers[1].buffer = worker_buffer.data();
+
+	counter_manager_t manager;
+	manager.init(&sdp_data);
+	const auto used_initial = std::get<0>(manager.stats());
+
+	counter counters;
+	counters.init(&manager);
+	for (uint32_t i = 0; i < 100; i++)
+	{
+		counters.insert({"a", i});
+	}
+	counters.allocate();
+	EXPECT_LT(used_initial, std::get<0>(manager.stats()));
+
+	/// chunk with one slot left is kept
+	for (uint32_t i = 1; i < 100; i++)
+	{
+		counters.remove({"a", i});
+	}
+	counters.gc();
+	counters.release();
+	EXPECT_EQ(used_initial + 64, std::get<0>(manager.stats()));
+
+	counters.remove({"a", 0});
+	counters.gc();
+	counters.release();
+	EXPECT_EQ(used_initial, std::get<0>(manager.stats()));
+
+	/// released chunk is reserved again
+	counters.insert({"b", 1});
+	counters.allocate();
+	EXPECT_NE(0u, counters.get_id({"b", 1}));
+	EXPECT_EQ(used_initial + 64, std::get<0>(manager.stats()));
+}
+
+TEST(Counter, ChunkRetry)
+{
+	std::vector<uint64_t> worker_buffer(YANET_CONFIG_COUNTERS_SIZE);
+
+	common::sdp::DataPlaneInSharedMemory sdp_data;
+	sdp_data.metadata_worker.start_counters = 0;
+	sdp_data.workers[1].buffer = worker_buffer.data();
+
+	counter_manager_t manager;
+	manager.init(&sdp_data);
+
+	/// one chunk per key, exhausts counters
+	counter_t<uint32_t, 64> exhaust;
+	exhaust.init(&manager);
+	const auto [used, total] = manager.stats();
+	const uint32_t exhaust_size = (total - used) / 64;
+	for (uint32_t i = 0; i < exhaust_size; i++)
+	{
+		exhaust.insert(i);
+	}
+	exhaust.allocate();
+	EXPECT_NE(0u, exhaust.get_id(exhaust_size - 1));
+
+	counter counters;
+	counters.init(&manager);
+	counters.insert({"a", 1});
+	counters.allocate();
+	EXPECT_EQ(0u, counters.get_id({"a", 1}));
+
+	exhaust.remove(0);
+	exhaust.gc();
+	exhaust.release();
+
+	/// next insert retries reservation, fallback slot gets own counters from zero
+	worker_buffer[exhaust.get_id(1) - 64] = 5;
+	counters.insert({"a", 2});
+	counters.allocate();
+	const auto counter_id = counters.get_id({"a", 1});
+	EXPECT_NE(0u, counter_id);
+	EXPECT_EQ(counter_id + 4, counters.get_id({"a", 2}));
+	EXPECT_EQ((std::array<uint64_t, 4>{0, 0, 0, 0}), counters.get_counters().at({"a", 1}));
+}
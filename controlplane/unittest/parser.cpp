@@ -772,4 +772,21 @@ add deny ip from any to any keep-state
 	EXPECT_EQ(firewall.get_rules_size(), keep_state_rules + implicit_check_state_rules);
 }
 
+TEST(Parser, 067_RateLimit)
+{
+	EXPECT_TRUE(parse_rules(R"IPFW(
+add rate-limit syn_flood 1000 2000 tcp from any to any setup
+add rate-limit max 4294967295 4294967295 ip from any to any
+)IPFW"));
+	EXPECT_FALSE(parse_rules(R"IPFW(
+add rate-limit zero 0 100 ip from any to any
+)IPFW"));
+	EXPECT_FALSE(parse_rules(R"IPFW(
+add rate-limit no_burst 100 0 ip from any to any
+)IPFW"));
+	EXPECT_FALSE(parse_rules(R"IPFW(
+add rate-limit wide 4294967296 100 ip from any to any
+)IPFW"));
+}
+
 } // namespace
@@ -230,3 +230,24 @@ int main(int argc, char** argv)
 	::testing::InitGoogleTest(&argc, argv);
 	return RUN_ALL_TESTS();
 }
+
+TEST(SegmentAllocator, FreeFromFullGroup)
+{
+	Errors no_errors(0, 0);
+
+	Allocator allocator;
+
+	// Block 0 holds 64 segments of length 2, one full group of segments.
+	for (uint32_t index = 0; index < 64; index++)
+	{
+		EXPECT_EQ(allocator.Allocate(2), 15 + index * 2);
+	}
+	EXPECT_EQ(Block(allocator, 2), BlockStat(1, 0, 64));
+
+	// The freed segment is allocated again, block 1 is not taken.
+	EXPECT_EQ(allocator.Free(77, 2), true);
+	EXPECT_EQ(allocator.Allocate(2), 77);
+	EXPECT_EQ(allocator.GetErrors(), no_errors);
+	EXPECT_EQ(Block(allocator, 2), BlockStat(1, 0, 64));
+	EXPECT_EQ(Block(allocator, 0), BlockStat(0, 2, 0));
+}
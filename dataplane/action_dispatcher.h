@@ -78,11 +78,26 @@ struct ActionDispatcher
 	{
 		for (const auto& action : actions)
 		{
+			bool passed = true;
+
 			std::visit([&](const auto& act) {
 				YANET_LOG_DEBUG("Executing action %s\n", act.to_string().c_str());
-				execute(act, flow, args);
+
+				if constexpr (std::is_same_v<std::decay_t<decltype(act)>, common::RateLimitAction>)
+				{
+					passed = execute(act, flow, args);
+				}
+				else
+				{
+					execute(act, flow, args);
+				}
 			},
 			           action.raw_action);
+
+			if (!passed)
+			{
+				return;
+			}
 		}
 	}
 
@@ -165,6 +180,22 @@ struct ActionDispatcher
 		worker->aclCounters[action.counter_id]++;
 		worker->populate_hitcount_map(action.id, mbuf);
 	}
+
+	/// @return false if packet exceeds the rate of the meter and is dropped
+	static bool execute(const common::RateLimitAction& action, [[maybe_unused]] const Flow& flow, const ActionDispatcherArgs& args)
+	{
+		auto worker = args.worker;
+
+		const auto& rate = args.base->globalBase->acl_meters[action.meter_id];
+		if (likely(worker->acl_meters[action.meter_id].consume(rate, rte_get_tsc_hz(), rte_get_tsc_cycles())))
+		{
+			return true;
+		}
+
+		worker->aclCounters[action.counter_id]++;
+		worker->drop(args.mbuf);
+		return false;
+	}
 };
 
 } // namespace dataplane
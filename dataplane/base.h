@@ -11,6 +11,8 @@
 #include "common/static_vector.h"
 #include "dpdk.h"
 #include "neighbor.h"
+#include "policer.h"
+#include "qos.h"
 #include "type.h"
 
 namespace dataplane::base
@@ -117,6 +119,10 @@ public:
 	tQueueId outQueueId;
 
 	uint32_t SWNormalPriorityRateLimitPerWorker;
+	dataplane::policer::config_t policer;
+	dataplane::qos::port_config_t qos[CONFIG_YADECAP_PORTS_SIZE]; ///< by logical port id
+	uint32_t idle_polls{};
+	uint32_t idle_sleep_max_us{};
 	uint8_t transportSizes[256];
 
 	uint16_t nat64stateful_numa_mask{0xFFFFu};
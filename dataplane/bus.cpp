@@ -222,6 +222,18 @@ void cBus::clientThread(int clientSocket)
 		{
 			response = callWithResponse(&cControlPlane::getFWState, request);
 		}
+		else if (type == common::idp::requestType::get_fw_state_page)
+		{
+			response = callWithResponse(&cControlPlane::get_fw_state_page, request);
+		}
+		else if (type == common::idp::requestType::state_export)
+		{
+			response = callWithResponse(&cControlPlane::state_export, request);
+		}
+		else if (type == common::idp::requestType::state_import)
+		{
+			response = callWithResponse(&cControlPlane::state_import, request);
+		}
 		else if (type == common::idp::requestType::getFWStateStats)
 		{
 			response = callWithResponse(&cControlPlane::getFWStateStats, request);
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "common/define.h"
+#include "common/policer.h"
+#include "common/qos.h"
 #include "common/type.h"
 #include <atomic>
 #include <set>
@@ -97,6 +99,8 @@ struct tDataPlaneConfig
 	uint32_t SWNormalPriorityRateLimitPerWorker = 0;
 	uint32_t SWICMPOutRateLimit = 0;
 	uint32_t rateLimitDivisor = 1;
+	common::policer::config_t policer;
+	std::map<InterfaceName, common::qos::port_config_t> qos;
 	std::string memory;
 	std::map<std::string, DumpConfig> shared_memory;
 
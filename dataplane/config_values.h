@@ -44,6 +44,10 @@ struct ConfigValues
 	uint64_t balancer_udp_timeout = YANET_CONFIG_BALANCER_STATE_TIMEOUT_DEFAULT;
 	uint64_t balancer_other_protocols_timeout = YANET_CONFIG_BALANCER_STATE_TIMEOUT_DEFAULT;
 	uint64_t neighbor_ht_size = 64 * 1024;
+	uint64_t worker_idle_polls = 0; ///< empty iterations before worker sleeps, zero means busy polling
+	uint64_t worker_idle_sleep_max_us = 100; ///< wake-up latency of idle worker is this plus a few us of nanosleep overshoot
+	uint64_t worker_mbuf_small_size = 0; ///< data room of worker small mbufs, zero disables small mempool
+	uint64_t worker_mbuf_jumbo_count = 0; ///< worker mbufs of CONFIG_YADECAP_MBUF_SIZE if small mempool is used, zero means default
 };
 
 inline void from_json(const nlohmann::json& j, ConfigValues& cfg)
@@ -103,4 +107,8 @@ inline void from_json(const nlohmann::json& j, ConfigValues& cfg)
 	cfg.balancer_udp_timeout = j.value("balancer_udp_timeout", cfg.balancer_udp_timeout);
 	cfg.balancer_other_protocols_timeout = j.value("balancer_other_protocols_timeout", cfg.balancer_other_protocols_timeout);
 	cfg.neighbor_ht_size = j.value("neighbor_ht_size", cfg.neighbor_ht_size);
+	cfg.worker_idle_polls = j.value("worker_idle_polls", cfg.worker_idle_polls);
+	cfg.worker_idle_sleep_max_us = j.value("worker_idle_sleep_max_us", cfg.worker_idle_sleep_max_us);
+	cfg.worker_mbuf_small_size = j.value("worker_mbuf_small_size", cfg.worker_mbuf_small_size);
+	cfg.worker_mbuf_jumbo_count = j.value("worker_mbuf_jumbo_count", cfg.worker_mbuf_jumbo_count);
 }
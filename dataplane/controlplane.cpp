@@ -2,6 +2,7 @@
 #include <optional>
 #include <sys/ioctl.h>
 #include <sys/un.h>
+#include <unistd.h>
 
 #include <rte_errno.h>
 #include <rte_ethdev.h>
@@ -14,6 +15,8 @@
 #include "dataplane.h"
 #include "dataplane/worker_gc.h"
 #include "debug_latch.h"
+#include "fw_state_page.h"
+#include "state_file.h"
 
 cControlPlane::cControlPlane(cDataPlane* dataPlane) :
         dataPlane(dataPlane),
@@ -491,37 +494,26 @@ common::idp::getFWState::response cControlPlane::getFWState()
 
 		for (const auto& [key, value] : fw_state)
 		{
-			const auto& [owner, flags, last_seen, packets_backward, packets_forward] = value;
-
-			auto it = response.find(key);
-			if (it == response.end())
-			{
-				response.emplace_hint(it, key, value);
-			}
-			else
-			{
-				auto& [first_owner, first_flags, first_last_seen, first_packets_backward, first_packets_forward] = it->second;
-
-				if (owner == (uint8_t)dataplane::globalBase::fw_state_owner_e::internal)
-				{
-					first_owner = owner;
-				}
-
-				if (last_seen > first_last_seen)
-				{
-					first_last_seen = last_seen;
-				}
-
-				first_packets_backward += packets_backward;
-				first_packets_forward += packets_forward;
-				first_flags |= flags;
-			}
+			dataplane::fw_state::merge(response, key, value);
 		}
 	}
 
 	return response;
 }
 
+common::idp::get_fw_state_page::response cControlPlane::get_fw_state_page(const common::idp::get_fw_state_page::request& request)
+{
+	return dataplane::fw_state::page(request, [&](const auto& callback) {
+		for (const auto& [core_id, worker_gc] : dataPlane->worker_gcs)
+		{
+			GCC_BUG_UNUSED(core_id);
+
+			std::lock_guard<std::mutex> guard(worker_gc->fw_state_mutex);
+			callback(worker_gc->fw_state);
+		}
+	});
+}
+
 common::idp::getFWStateStats::response cControlPlane::getFWStateStats() ///< @todo: DELETE
 {
 	common::fwstate::stats_t stats{};
@@ -549,6 +541,158 @@ eResult cControlPlane::clearFWState()
 	return common::result_e::success;
 }
 
+eResult cControlPlane::state_export(const common::idp::state_export::request& request)
+{
+	using namespace dataplane::globalBase;
+	using namespace dataplane::state_file;
+
+	std::vector<acl::ipv4_states_ht::updater*> fw4_state;
+	std::vector<acl::ipv6_states_ht::updater*> fw6_state;
+	std::vector<nat64stateful::lan_ht::updater*> nat64stateful_lan_state;
+	std::vector<nat64stateful::wan_ht::updater*> nat64stateful_wan_state;
+	std::vector<balancer::state_ht::updater*> balancer_state;
+	for (auto& [socket_id, globalBaseAtomic] : dataPlane->globalBaseAtomics)
+	{
+		GCC_BUG_UNUSED(socket_id);
+
+		fw4_state.emplace_back(&globalBaseAtomic->updater.fw4_state);
+		fw6_state.emplace_back(&globalBaseAtomic->updater.fw6_state);
+		nat64stateful_lan_state.emplace_back(&globalBaseAtomic->updater.nat64stateful_lan_state);
+		nat64stateful_wan_state.emplace_back(&globalBaseAtomic->updater.nat64stateful_wan_state);
+		balancer_state.emplace_back(&globalBaseAtomic->updater.balancer_state);
+	}
+
+	/// file appears under its name only when complete
+	const std::string temporary_path = request + ".tmp";
+	FILE* file = fopen(temporary_path.data(), "wb");
+	if (!file)
+	{
+		YANET_LOG_ERROR("state export: failed to open '%s': %s\n", temporary_path.data(), strerror(errno));
+		return eResult::errorOpenFile;
+	}
+
+	eResult result = write_header(file, 5);
+	if (result == eResult::success)
+	{
+		result = write_table<acl::ipv4_states_ht>(file, "acl.state.v4.ht", fw4_state);
+	}
+	if (result == eResult::success)
+	{
+		result = write_table<acl::ipv6_states_ht>(file, "acl.state.v6.ht", fw6_state);
+	}
+	if (result == eResult::success)
+	{
+		result = write_table<nat64stateful::lan_ht>(file, "nat64stateful.state.lan.ht", nat64stateful_lan_state);
+	}
+	if (result == eResult::success)
+	{
+		result = write_table<nat64stateful::wan_ht>(file, "nat64stateful.state.wan.ht", nat64stateful_wan_state);
+	}
+	if (result == eResult::success)
+	{
+		result = write_table<balancer::state_ht>(file, "balancer.state.ht", balancer_state);
+	}
+
+	if (fclose(file) != 0 && result == eResult::success)
+	{
+		result = eResult::errorOpenFile;
+	}
+
+	if (result != eResult::success)
+	{
+		YANET_LOG_ERROR("state export: failed to write '%s'\n", temporary_path.data());
+		unlink(temporary_path.data());
+		return result;
+	}
+
+	if (rename(temporary_path.data(), request.data()) != 0)
+	{
+		YANET_LOG_ERROR("state export: failed to rename '%s': %s\n", temporary_path.data(), strerror(errno));
+		unlink(temporary_path.data());
+		return eResult::errorOpenFile;
+	}
+
+	return eResult::success;
+}
+
+eResult cControlPlane::state_import(const common::idp::state_import::request& request)
+{
+	using namespace dataplane::globalBase;
+	using namespace dataplane::state_file;
+
+	std::vector<acl::ipv4_states_ht*> fw4_state;
+	std::vector<acl::ipv6_states_ht*> fw6_state;
+	std::vector<nat64stateful::lan_ht*> nat64stateful_lan_state;
+	std::vector<nat64stateful::wan_ht*> nat64stateful_wan_state;
+	std::vector<balancer::state_ht*> balancer_state;
+	for (auto& [socket_id, globalBaseAtomic] : dataPlane->globalBaseAtomics)
+	{
+		GCC_BUG_UNUSED(socket_id);
+
+		fw4_state.emplace_back(globalBaseAtomic->fw4_state);
+		fw6_state.emplace_back(globalBaseAtomic->fw6_state);
+		nat64stateful_lan_state.emplace_back(globalBaseAtomic->nat64stateful_lan_state);
+		nat64stateful_wan_state.emplace_back(globalBaseAtomic->nat64stateful_wan_state);
+		balancer_state.emplace_back(globalBaseAtomic->balancer_state);
+	}
+
+	FILE* file = fopen(request.data(), "rb");
+	if (!file)
+	{
+		YANET_LOG_ERROR("state import: failed to open '%s': %s\n", request.data(), strerror(errno));
+		return eResult::errorOpenFile;
+	}
+
+	file_header_t file_header;
+	eResult result = read_header(file, file_header);
+	for (uint32_t table_i = 0;
+	     table_i < file_header.tables_count && result == eResult::success;
+	     table_i++)
+	{
+		table_header_t header;
+		result = read_table_header(file, header);
+		if (result != eResult::success)
+		{
+			break;
+		}
+
+		const std::string_view name = header.name;
+		if (name == "acl.state.v4.ht")
+		{
+			result = read_table<acl::ipv4_states_ht>(file, header, fw4_state);
+		}
+		else if (name == "acl.state.v6.ht")
+		{
+			result = read_table<acl::ipv6_states_ht>(file, header, fw6_state);
+		}
+		else if (name == "nat64stateful.state.lan.ht")
+		{
+			result = read_table<nat64stateful::lan_ht>(file, header, nat64stateful_lan_state);
+		}
+		else if (name == "nat64stateful.state.wan.ht")
+		{
+			result = read_table<nat64stateful::wan_ht>(file, header, nat64stateful_wan_state);
+		}
+		else if (name == "balancer.state.ht")
+		{
+			result = read_table<balancer::state_ht>(file, header, balancer_state);
+		}
+		else
+		{
+			result = skip_table(file, header);
+		}
+	}
+
+	fclose(file);
+
+	if (result != eResult::success)
+	{
+		YANET_LOG_ERROR("state import: failed to read '%s'\n", request.data());
+	}
+
+	return result;
+}
+
 common::idp::getPortStatsEx::response cControlPlane::getPortStatsEx()
 {
 	common::idp::getPortStatsEx::response response;
@@ -1161,15 +1305,45 @@ eResult cControlPlane::balancer_state_clear()
 
 common::idp::nat64stateful_state::response cControlPlane::nat64stateful_state(const common::idp::nat64stateful_state::request& request)
 {
-	common::idp::nat64stateful_state::response response;
+	const auto& [filter_nat64stateful_id, cursor, request_limit] = request;
 
-	for (auto& [core_id, worker_gc] : dataPlane->worker_gcs)
+	/// empty page would return the request cursor as the next one, and paging would never end
+	const uint32_t limit = std::max(request_limit, (uint32_t)1);
+
+	common::idp::nat64stateful_state::states states;
+
+	auto it = dataPlane->worker_gcs.begin();
+	uint32_t offset = 0;
+	if (cursor)
 	{
-		GCC_BUG_UNUSED(core_id);
-		worker_gc->nat64stateful_state(request, response);
+		const auto& [cursor_core_id, cursor_offset] = *cursor;
+		it = dataPlane->worker_gcs.lower_bound(cursor_core_id);
+		if (it != dataPlane->worker_gcs.end() &&
+		    it->first == cursor_core_id)
+		{
+			offset = cursor_offset;
+		}
 	}
 
-	return response;
+	for (;
+	     it != dataPlane->worker_gcs.end();
+	     ++it)
+	{
+		auto& [core_id, worker_gc] = *it;
+
+		if (states.size() >= limit)
+		{
+			return {std::move(states), common::idp::nat64stateful_state::cursor(core_id, 0)};
+		}
+
+		worker_gc->nat64stateful_state(filter_nat64stateful_id, offset, limit, states);
+		if (offset)
+		{
+			return {std::move(states), common::idp::nat64stateful_state::cursor(core_id, offset)};
+		}
+	}
+
+	return {std::move(states), std::nullopt};
 }
 
 void cControlPlane::switchBase()
@@ -61,8 +61,11 @@ public:
 	[[nodiscard]] dataplane::hashtable_chain_spinlock_stats_t DregressConnectionsStats() const;
 	[[nodiscard]] dregress::LimitsStats DregressLimitsStats() const;
 	common::idp::getFWState::response getFWState();
+	common::idp::get_fw_state_page::response get_fw_state_page(const common::idp::get_fw_state_page::request& request);
 	common::idp::getFWStateStats::response getFWStateStats();
 	eResult clearFWState();
+	eResult state_export(const common::idp::state_export::request& request);
+	eResult state_import(const common::idp::state_import::request& request);
 	[[nodiscard]] common::idp::getConfig::response getConfig() const;
 	common::idp::getErrors::response getErrors();
 	common::idp::getReport::response getReport();
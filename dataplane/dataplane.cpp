@@ -83,12 +83,14 @@ eResult cDataPlane::init(const std::string& binaryPath,
 	eResult result = eResult::success;
 
 	current_time = time(nullptr);
+	startup_time_point = std::chrono::steady_clock::now();
 
 	result = parseConfig(configFilePath);
 	if (result != eResult::success)
 	{
 		return result;
 	}
+	startup_timing("config");
 
 	/// init environment abstraction layer
 	std::string filePrefix;
@@ -119,12 +121,14 @@ eResult cDataPlane::init(const std::string& binaryPath,
 	{
 		return result;
 	}
+	startup_timing("eal");
 
 	result = initPorts();
 	if (result != eResult::success)
 	{
 		return result;
 	}
+	startup_timing("ports");
 
 	if (config.use_kernel_interface)
 	{
@@ -195,6 +199,7 @@ eResult cDataPlane::init(const std::string& binaryPath,
 	{
 		return result;
 	}
+	startup_timing("shared_memory");
 
 	result = initWorkers();
 	if (result != eResult::success)
@@ -207,6 +212,7 @@ eResult cDataPlane::init(const std::string& binaryPath,
 	{
 		return result;
 	}
+	startup_timing("workers");
 
 	result = splitSharedMemoryPerWorkers();
 	if (result != eResult::success)
@@ -272,6 +278,7 @@ eResult cDataPlane::init(const std::string& binaryPath,
 	{
 		return result;
 	}
+	startup_timing("queues");
 
 	result = controlPlane->init(config.use_kernel_interface);
 	if (result != eResult::success)
@@ -285,6 +292,7 @@ eResult cDataPlane::init(const std::string& binaryPath,
 		return result;
 	}
 	bus.SetBufferForCounters(sdp_data);
+	neighbor.SetBufferForTables(sdp_data);
 
 	result = neighbor.init(
 	        get_socket_ids(),
@@ -929,9 +937,21 @@ eResult cDataPlane::initGlobalBases()
 		socket_ids.emplace(socketId);
 	}
 
+	startup_timing("globalbases");
+
 	return result;
 }
 
+void cDataPlane::startup_timing(const char* phase)
+{
+	auto time_point = std::chrono::steady_clock::now();
+	uint64_t duration = std::chrono::duration_cast<std::chrono::milliseconds>(time_point - startup_time_point).count();
+	startup_time_point = time_point;
+
+	YANET_LOG_INFO("startup: %s: %lu ms\n", phase, duration);
+	startup_timings.emplace_back(phase, duration);
+}
+
 eResult cDataPlane::initWorkers()
 {
 	for (const auto& configWorkerIter : config.workers)
@@ -996,9 +1016,15 @@ eResult cDataPlane::initWorkers()
 			GCC_BUG_UNUSED(mac_address);
 			GCC_BUG_UNUSED(pci);
 
-			if (!basePermanently.ports.Register(port_id))
+			auto logical_port_id = basePermanently.ports.Register(port_id);
+			if (!logical_port_id)
 				return eResult::invalidPortsCount;
 
+			if (exist(config.qos, interface_name))
+			{
+				basePermanently.qos[*logical_port_id] = config.qos[interface_name];
+			}
+
 			if (exist(rx_queues, coreId))
 			{
 				YANET_LOG_DEBUG("worker[%u]: add_worker_port(port_id: %u, queue_id: %u)\n",
@@ -1063,6 +1089,9 @@ eResult cDataPlane::initWorkers()
 		}
 
 		basePermanently.outQueueId = tx_queues_;
+		basePermanently.policer = config.policer;
+		basePermanently.idle_polls = config_values_.worker_idle_polls;
+		basePermanently.idle_sleep_max_us = config_values_.worker_idle_sleep_max_us;
 
 		dataplane::base::generation base;
 		{
@@ -1375,12 +1404,43 @@ eResult cDataPlane::InitRxQueues()
 	{
 		for (const auto& [port, queue] : worker->basePermanently.rx_points)
 		{
+			rte_eth_dev_info dev_info;
+			if (rte_eth_dev_info_get(port, &dev_info) != 0)
+			{
+				YADECAP_LOG_ERROR("rte_eth_dev_info_get(%u)\n", port);
+				return eResult::errorInitQueue;
+			}
+
+			rte_eth_rxconf rx_conf = dev_info.default_rxconf;
+			rte_mempool* mempool = worker->mempool;
+
+			if (worker->mempool_small)
+			{
+#if RTE_VERSION >= RTE_VERSION_NUM(23, 3, 0, 0)
+				/// PMD puts each packet into the smallest buffer it fits
+				rte_mempool* rx_mempools[] = {worker->mempool_small, worker->mempool};
+				if (dev_info.max_rx_mempools >= 2)
+				{
+					rx_conf.rx_mempools = rx_mempools;
+					rx_conf.rx_nmempool = 2;
+					mempool = nullptr;
+				}
+				else
+#endif
+				{
+					YANET_LOG_WARNING("port %u does not support multiple rx mempools, rx queue %u uses %u bytes mbufs\n",
+					                  port,
+					                  queue,
+					                  CONFIG_YADECAP_MBUF_SIZE);
+				}
+			}
+
 			int ret = rte_eth_rx_queue_setup(port,
 			                                 queue,
 			                                 getConfigValues().port_rx_queue_size,
 			                                 worker->socketId,
-			                                 nullptr,
-			                                 worker->mempool);
+			                                 &rx_conf,
+			                                 mempool);
 			if (ret < 0)
 			{
 				YADECAP_LOG_ERROR("rte_eth_rx_queue_setup(%u, %u) = %d\n", port, queue, ret);
@@ -1641,6 +1701,7 @@ eResult cDataPlane::initSharedMemory()
 	cWorker::FillMetadataWorkerCounters(sdp_data.metadata_worker);
 	worker_gc_t::FillMetadataWorkerCounters(sdp_data.metadata_worker_gc);
 	sdp_data.size_bus_section = cBus::GetSizeForCounters();
+	sdp_data.neighbor_capacity = getConfigValues().neighbor_ht_size;
 
 	return common::sdp::SdrSever::PrepareSharedMemoryData(sdp_data, workers_id, workers_gc_id, config.useHugeMem);
 }
@@ -1986,6 +2047,7 @@ void cDataPlane::switchGlobalBase()
 	{
 		std::lock_guard<std::mutex> guard(currentGlobalBaseId_mutex);
 		currentGlobalBaseId ^= 1;
+		globalBaseSerial++;
 	}
 
 	YADECAP_MEMORY_BARRIER_COMPILE;
@@ -2105,6 +2167,15 @@ eResult cDataPlane::parseConfig(const std::string& configFilePath)
 		}
 	}
 
+	if (rootJson.find("qos") != rootJson.end())
+	{
+		result = parseQos(rootJson.find("qos").value());
+		if (result != eResult::success)
+		{
+			return result;
+		}
+	}
+
 	auto it = rootJson.find("ealArgs");
 	if (it != rootJson.end())
 	{
@@ -2325,6 +2396,127 @@ eResult cDataPlane::parseRateLimits(const nlohmann::json& json)
 
 	config.SWICMPOutRateLimit = json.value("OutICMP", 0);
 
+	if (json.find("policer") != json.end())
+	{
+		return parsePolicer(json.find("policer").value());
+	}
+
+	return eResult::success;
+}
+
+eResult cDataPlane::parsePolicer(const nlohmann::json& json)
+{
+	auto& policer = config.policer;
+
+	policer.table_size = json.value("table_size", policer.table_size);
+	policer.ipv4_prefix = json.value("ipv4_prefix", policer.ipv4_prefix);
+	policer.ipv6_prefix = json.value("ipv6_prefix", policer.ipv6_prefix);
+
+	if (policer.ipv4_prefix > 32 || policer.ipv6_prefix > 128)
+	{
+		YADECAP_LOG_ERROR("invalid policer prefix length\n");
+		return eResult::invalidConfigurationFile;
+	}
+
+	if (json.find("classes") == json.end())
+	{
+		return eResult::success;
+	}
+
+	for (const auto& [class_name, class_json] : json.find("classes").value().items())
+	{
+		auto class_id = common::policer::class_from_string(class_name);
+		if (!class_id)
+		{
+			YADECAP_LOG_ERROR("unknown policer class: '%s'\n", class_name.data());
+			return eResult::invalidConfigurationFile;
+		}
+
+		auto& class_config = policer.classes[(uint8_t)*class_id];
+		const uint32_t workers_count = std::max(config.workers.size(), (size_t)1);
+
+		/// rates are configured per dataplane and split between workers.
+		/// rss hashes the whole 5-tuple, so packets of one source reach every worker
+		auto per_worker = [workers_count](uint32_t value) -> uint32_t {
+			/// zero means unlimited, keep a non-zero limit from rounding down to it
+			return value ? std::max(value / workers_count, (uint32_t)1) : 0;
+		};
+
+		class_config.aggregate.rate = per_worker(class_json.value("rate", 0u));
+		class_config.aggregate.burst = per_worker(class_json.value("burst", 0u));
+		class_config.source.rate = per_worker(class_json.value("source_rate", 0u));
+		class_config.source.burst = per_worker(class_json.value("source_burst", 0u));
+	}
+
+	return eResult::success;
+}
+
+eResult cDataPlane::parseQos(const nlohmann::json& json)
+{
+	for (const auto& [interface_name, port_json] : json.items())
+	{
+		if (!exist(config.ports, interface_name))
+		{
+			YADECAP_LOG_ERROR("qos: unknown interface '%s'\n", interface_name.data());
+			return eResult::invalidConfigurationFile;
+		}
+
+		common::qos::port_config_t port_config;
+		const uint32_t workers_count = std::max(config.workers.size(), (size_t)1);
+
+		/// every worker transmits to its own tx queue, so port rate is split between workers
+		port_config.rate = port_json.value("rate", (uint64_t)0) / workers_count;
+		port_config.burst = port_json.value("burst", 0u) / workers_count;
+
+		if (port_json.find("classes") == port_json.end() ||
+		    port_json["classes"].empty() ||
+		    port_json["classes"].size() > YANET_CONFIG_QOS_CLASSES_SIZE)
+		{
+			YADECAP_LOG_ERROR("qos: interface '%s': invalid classes count\n", interface_name.data());
+			return eResult::invalidConfigurationFile;
+		}
+
+		port_config.classes_count = port_json["classes"].size();
+
+		/// unmapped dscp values go to the last class
+		std::fill(std::begin(port_config.dscp_to_class),
+		          std::end(port_config.dscp_to_class),
+		          port_config.classes_count - 1);
+
+		uint8_t class_id = 0;
+		for (const auto& class_json : port_json["classes"])
+		{
+			auto& class_config = port_config.classes[class_id];
+			class_config.priority = class_json.value("priority", class_config.priority);
+			class_config.weight = class_json.value("weight", class_config.weight);
+			class_config.queue_size = class_json.value("queue_size", class_config.queue_size);
+
+			if (class_config.weight == 0 || class_config.queue_size == 0)
+			{
+				YADECAP_LOG_ERROR("qos: interface '%s': invalid class '%u'\n", interface_name.data(), class_id);
+				return eResult::invalidConfigurationFile;
+			}
+
+			if (class_json.find("dscp") != class_json.end())
+			{
+				for (const uint32_t dscp : class_json["dscp"])
+				{
+					if (dscp >= common::qos::dscp_size)
+					{
+						YADECAP_LOG_ERROR("qos: interface '%s': invalid dscp '%u'\n", interface_name.data(), dscp);
+						return eResult::invalidConfigurationFile;
+					}
+
+					port_config.dscp_to_class[dscp] = class_id;
+				}
+			}
+
+			class_id++;
+		}
+
+		config.qos[interface_name] = port_config;
+	}
+
 	return eResult::success;
 }
 
@@ -89,7 +89,9 @@ protected:
 	nlohmann::json makeLegacyControlPlaneWorkerConfig();
 	eResult parseConfigValues(const nlohmann::json& json);
 	eResult parseRateLimits(const nlohmann::json& json);
+	eResult parsePolicer(const nlohmann::json& json);
 	eResult parseSharedMemory(const nlohmann::json& json);
+	eResult parseQos(const nlohmann::json& json);
 	eResult checkConfig();
 
 	eResult initEal(const std::string& binaryPath, const std::string& filePrefix);
@@ -135,6 +137,9 @@ protected:
 	eResult allocateSharedMemory();
 	eResult splitSharedMemoryPerWorkers();
 
+	/// remembers time spent since previous startup phase
+	void startup_timing(const char* phase);
+
 	common::idp::get_shm_info::response getShmInfo();
 	common::idp::get_shm_tsc_info::response getShmTscInfo();
 	const common::idp::hitcount_dump::response& getHitcountMap();
@@ -183,7 +188,7 @@ public:
 protected:
 	size_t numaNodesInUse;
 	std::map<tSocketId, std::array<dataplane::globalBase::generation*, 2>> globalBases;
-	uint32_t globalBaseSerial;
+	uint32_t globalBaseSerial; ///< incremented by switchGlobalBase, under currentGlobalBaseId_mutex
 
 	std::map<std::string,
 	         std::tuple<int, ///< socket
@@ -212,6 +217,11 @@ protected:
 	std::map<tSocketId, worker_gc_t*> socket_worker_gcs;
 	std::map<tSocketId, rte_mempool*> socket_cplane_mempools;
 
+	std::chrono::steady_clock::time_point startup_time_point;
+	std::vector<std::tuple<std::string, ///< phase
+	                       uint64_t>> ///< milliseconds
+	        startup_timings;
+
 	std::atomic<bool> workers_started_ = false;
 	std::vector<cWorker*> workers_vector;
 
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <algorithm>
+#include <map>
+
+#include "common/idp.h"
+
+namespace dataplane::fw_state
+{
+
+using map_t = std::map<common::idp::getFWState::key_t, common::idp::getFWState::value_t>;
+
+/// bounds time of holding a state map lock, when filter skips most of states
+constexpr uint32_t scan_limit = 64 * 1024;
+
+inline bool match(const common::idp::get_fw_state_page::filter_t& filter,
+                  const common::idp::getFWState::key_t& key)
+{
+	const auto& [proto, src, dst, src_port, dst_port] = filter;
+	const auto& [key_proto, key_src, key_dst, key_src_port, key_dst_port] = key;
+
+	return (!proto || *proto == key_proto) &&
+	       (!src_port || *src_port == key_src_port) &&
+	       (!dst_port || *dst_port == key_dst_port) &&
+	       (!src || src->subnetFor(key_src)) &&
+	       (!dst || dst->subnetFor(key_dst));
+}
+
+inline void merge(common::idp::getFWState::response& response,
+                  const common::idp::getFWState::key_t& key,
+                  const common::idp::getFWState::value_t& value)
+{
+	const auto& [owner, flags, last_seen, packets_backward, packets_forward] = value;
+
+	auto it = response.find(key);
+	if (it == response.end())
+	{
+		response.emplace_hint(it, key, value);
+	}
+	else
+	{
+		auto& [first_owner, first_flags, first_last_seen, first_packets_backward, first_packets_forward] = it->second;
+
+		if (owner == (uint8_t)common::fwstate::owner_e::internal)
+		{
+			first_owner = owner;
+		}
+
+		if (last_seen > first_last_seen)
+		{
+			first_last_seen = last_seen;
+		}
+
+		first_packets_backward += packets_backward;
+		first_packets_forward += packets_forward;
+		first_flags |= flags;
+	}
+}
+
+/// for_each_map(callback) calls callback(const map_t&) for every state map, holding its lock
+template<typename for_each_map_T>
+common::idp::get_fw_state_page::response page(const common::idp::get_fw_state_page::request& request,
+                                              const for_each_map_T& for_each_map)
+{
+	const auto& [filter, cursor, request_limit] = request;
+
+	/// empty page would return the request cursor as the next one, and paging would never end
+	const uint32_t limit = std::max(request_limit, (uint32_t)1);
+
+	common::idp::getFWState::response states;
+	std::optional<common::idp::getFWState::key_t> next_cursor;
+
+	for_each_map([&](const map_t& fw_state) {
+		auto it = cursor ? fw_state.lower_bound(*cursor) : fw_state.begin();
+
+		uint32_t scanned = 0;
+		uint32_t matched = 0;
+		for (;
+		     it != fw_state.end() && scanned < scan_limit && matched < limit;
+		     ++it, scanned++)
+		{
+			if (match(filter, it->first))
+			{
+				merge(states, it->first, it->second);
+				matched++;
+			}
+		}
+
+		/// states of this map starting from 'it' are not seen yet
+		if (it != fw_state.end() &&
+		    (!next_cursor || it->first < *next_cursor))
+		{
+			next_cursor = it->first;
+		}
+	});
+
+	if (next_cursor)
+	{
+		states.erase(states.lower_bound(*next_cursor), states.end());
+	}
+
+	if (states.size() > limit)
+	{
+		auto it = std::next(states.begin(), limit);
+		next_cursor = it->first;
+		states.erase(it, states.end());
+	}
+
+	return {std::move(states), next_cursor};
+}
+
+}
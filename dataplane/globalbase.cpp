@@ -2,6 +2,7 @@
 
 #include <rte_errno.h>
 
+#include "checksum.h"
 #include "common.h"
 #include "dataplane.h"
 #include "globalbase.h"
@@ -192,6 +193,45 @@ eResult generation::init()
 		acl.values = updater.acl.values->pointer;
 	}
 
+	{
+		updater.nat64stateless_translations = std::make_unique<nat64stateless::translations>("nat64stateless.translations",
+		                                                                                     &dataPlane->memory_manager,
+		                                                                                     socketId);
+		result = updater.nat64stateless_translations->init();
+		if (result != eResult::success)
+		{
+			return result;
+		}
+
+		nat64statelessTranslations = updater.nat64stateless_translations->pointer;
+	}
+
+	{
+		updater.nat64stateless_ingress_lookup = std::make_unique<nat64stateless::ingress_lookup>("nat64stateless.ingress.ht",
+		                                                                                         &dataPlane->memory_manager,
+		                                                                                         socketId);
+		result = updater.nat64stateless_ingress_lookup->init();
+		if (result != eResult::success)
+		{
+			return result;
+		}
+
+		nat64stateless_ingress_lookup = updater.nat64stateless_ingress_lookup->pointer;
+	}
+
+	{
+		updater.nat64stateless_egress_lookup = std::make_unique<nat64stateless::egress_lookup>("nat64stateless.egress.ht",
+		                                                                                       &dataPlane->memory_manager,
+		                                                                                       socketId);
+		result = updater.nat64stateless_egress_lookup->init();
+		if (result != eResult::success)
+		{
+			return result;
+		}
+
+		nat64stateless_egress_lookup = updater.nat64stateless_egress_lookup->pointer;
+	}
+
 	{
 		updater.route_lpm4 = std::make_unique<updater_lpm4_24bit_8bit>("route.v4.lpm",
 		                                                               &dataPlane->memory_manager,
@@ -434,6 +474,10 @@ eResult generation::update(const common::idp::updateGlobalBase::request& request
 		{
 			result = dump_tags_ids(std::get<common::idp::updateGlobalBase::dump_tags_ids::request>(data));
 		}
+		else if (type == common::idp::updateGlobalBase::requestType::acl_meters)
+		{
+			result = acl_meters_update(std::get<common::idp::updateGlobalBase::acl_meters::request>(data));
+		}
 		else if (type == common::idp::updateGlobalBase::requestType::dregress_prefix_update)
 		{
 			result = dregress_prefix_update(std::get<common::idp::updateGlobalBase::dregress_prefix_update::request>(data));
@@ -492,6 +536,10 @@ eResult generation::update(const common::idp::updateGlobalBase::request& request
 		{
 			result = update_host_config(std::get<common::idp::updateGlobalBase::update_host_config::request>(data));
 		}
+		else if (type == common::idp::updateGlobalBase::requestType::nat64stateless_lookup_update)
+		{
+			result = nat64stateless_lookup_update(std::get<common::idp::updateGlobalBase::nat64stateless_lookup_update::request>(data));
+		}
 		else
 		{
 			YADECAP_LOG_ERROR("invalid request type\n");
@@ -737,7 +785,8 @@ static bool checkFlow(const common::globalBase::tFlow& flow)
 			return false;
 		}
 
-		if (flow.data.nat64stateless.translationId >= CONFIG_YADECAP_NAT64STATELESS_TRANSLATIONS_SIZE)
+		if (flow.data.nat64stateless.translationId >= CONFIG_YADECAP_NAT64STATELESS_TRANSLATIONS_SIZE &&
+		    flow.data.nat64stateless.translationId != common::globalBase::nat64stateless_translation_lookup)
 		{
 			return false;
 		}
@@ -749,7 +798,8 @@ static bool checkFlow(const common::globalBase::tFlow& flow)
 			return false;
 		}
 
-		if (flow.data.nat64stateless.translationId >= CONFIG_YADECAP_NAT64STATELESS_TRANSLATIONS_SIZE)
+		if (flow.data.nat64stateless.translationId >= CONFIG_YADECAP_NAT64STATELESS_TRANSLATIONS_SIZE &&
+		    flow.data.nat64stateless.translationId != common::globalBase::nat64stateless_translation_lookup)
 		{
 			return false;
 		}
@@ -761,7 +811,8 @@ static bool checkFlow(const common::globalBase::tFlow& flow)
 			return false;
 		}
 
-		if (flow.data.nat64stateless.translationId >= CONFIG_YADECAP_NAT64STATELESS_TRANSLATIONS_SIZE)
+		if (flow.data.nat64stateless.translationId >= CONFIG_YADECAP_NAT64STATELESS_TRANSLATIONS_SIZE &&
+		    flow.data.nat64stateless.translationId != common::globalBase::nat64stateless_translation_lookup)
 		{
 			return false;
 		}
@@ -773,7 +824,8 @@ static bool checkFlow(const common::globalBase::tFlow& flow)
 			return false;
 		}
 
-		if (flow.data.nat64stateless.translationId >= CONFIG_YADECAP_NAT64STATELESS_TRANSLATIONS_SIZE)
+		if (flow.data.nat64stateless.translationId >= CONFIG_YADECAP_NAT64STATELESS_TRANSLATIONS_SIZE &&
+		    flow.data.nat64stateless.translationId != common::globalBase::nat64stateless_translation_lookup)
 		{
 			return false;
 		}
@@ -785,7 +837,8 @@ static bool checkFlow(const common::globalBase::tFlow& flow)
 			return false;
 		}
 
-		if (flow.data.nat64stateless.translationId >= CONFIG_YADECAP_NAT64STATELESS_TRANSLATIONS_SIZE)
+		if (flow.data.nat64stateless.translationId >= CONFIG_YADECAP_NAT64STATELESS_TRANSLATIONS_SIZE &&
+		    flow.data.nat64stateless.translationId != common::globalBase::nat64stateless_translation_lookup)
 		{
 			return false;
 		}
@@ -797,7 +850,8 @@ static bool checkFlow(const common::globalBase::tFlow& flow)
 			return false;
 		}
 
-		if (flow.data.nat64stateless.translationId >= CONFIG_YADECAP_NAT64STATELESS_TRANSLATIONS_SIZE)
+		if (flow.data.nat64stateless.translationId >= CONFIG_YADECAP_NAT64STATELESS_TRANSLATIONS_SIZE &&
+		    flow.data.nat64stateless.translationId != common::globalBase::nat64stateless_translation_lookup)
 		{
 			return false;
 		}
@@ -1364,6 +1418,21 @@ eResult generation::updateNat64statelessTranslation(const common::idp::updateGlo
 		return eResult::invalidNat64statelessTranslationId;
 	}
 
+	if (nat64statelessTranslationId >= updater.nat64stateless_translations->size())
+	{
+		/// this generation is not used by workers while updating
+		const uint64_t count = std::min((uint64_t)upper_power_of_two(std::max(nat64statelessTranslationId + 1, (uint32_t)1024)),
+		                                (uint64_t)CONFIG_YADECAP_NAT64STATELESS_TRANSLATIONS_SIZE);
+		eResult result = updater.nat64stateless_translations->grow(count);
+		if (result != eResult::success)
+		{
+			YANET_LOG_ERROR("nat64stateless.translations.grow(): %s\n", result_to_c_str(result));
+			return result;
+		}
+
+		nat64statelessTranslations = updater.nat64stateless_translations->pointer;
+	}
+
 	auto& nat64statelessTranslation = nat64statelessTranslations[nat64statelessTranslationId];
 
 	nat64statelessTranslation.ipv6Address = ipv6_address_t::convert(ipv6Address);
@@ -1383,6 +1452,54 @@ eResult generation::updateNat64statelessTranslation(const common::idp::updateGlo
 	return eResult::success;
 }
 
+eResult generation::nat64stateless_lookup_update(const common::idp::updateGlobalBase::nat64stateless_lookup_update::request& request)
+{
+	const auto& [ingress, egress] = request;
+
+	std::vector<std::tuple<nat64stateless_ingress_key_t, uint32_t>> ingress_convert;
+	ingress_convert.reserve(ingress.size());
+	for (const auto& [nat64stateless_id, ipv6Address, ipv6DestinationAddress, translation_id] : ingress)
+	{
+		nat64stateless_ingress_key_t key;
+		key.ipv6Address = ipv6_address_t::convert(ipv6Address);
+		memcpy(key.ipv6DestinationPrefix, ipv6_address_t::convert(ipv6DestinationAddress).bytes, sizeof(key.ipv6DestinationPrefix));
+		key.nat64stateless_id = nat64stateless_id;
+
+		ingress_convert.emplace_back(key, translation_id);
+	}
+
+	std::vector<std::tuple<nat64stateless_egress_key_t, uint32_t>> egress_convert;
+	egress_convert.reserve(egress.size());
+	for (const auto& [nat64stateless_id, ipv4Address, translation_id] : egress)
+	{
+		nat64stateless_egress_key_t key;
+		key.ipv4Address = ipv4_address_t::convert(ipv4Address);
+		key.nat64stateless_id = nat64stateless_id;
+
+		egress_convert.emplace_back(key, translation_id);
+	}
+
+	eResult result = updater.nat64stateless_ingress_lookup->update(ingress_convert);
+	if (result != eResult::success)
+	{
+		YANET_LOG_ERROR("nat64stateless.ingress.ht.update(): %s\n", result_to_c_str(result));
+		return result;
+	}
+
+	nat64stateless_ingress_lookup = updater.nat64stateless_ingress_lookup->pointer;
+
+	result = updater.nat64stateless_egress_lookup->update(egress_convert);
+	if (result != eResult::success)
+	{
+		YANET_LOG_ERROR("nat64stateless.egress.ht.update(): %s\n", result_to_c_str(result));
+		return result;
+	}
+
+	nat64stateless_egress_lookup = updater.nat64stateless_egress_lookup->pointer;
+
+	return eResult::success;
+}
+
 eResult generation::nat46clat_update(const common::idp::updateGlobalBase::nat46clat_update::request& request)
 {
 	const auto& [nat46clat_id, ipv6_source, ipv6_destination, dscp_mark_type, dscp, counter_id, flow, vrf_lan, vrf_wan] = request;
@@ -1412,6 +1529,8 @@ eResult generation::nat46clat_update(const common::idp::updateGlobalBase::nat46c
 	auto& nat46clat = nat46clats[nat46clat_id];
 	nat46clat.ipv6_source = ipv6_address_t::convert(ipv6_source);
 	nat46clat.ipv6_destination = ipv6_address_t::convert(ipv6_destination);
+	nat46clat.ipv6_prefixes_checksum = csum_plus(yanet_checksum(nat46clat.ipv6_source.bytes, 12),
+	                                             yanet_checksum(nat46clat.ipv6_destination.bytes, 12));
 	nat46clat.counter_id = counter_id;
 	nat46clat.flow = flow;
 
@@ -2386,11 +2505,23 @@ eResult generation::acl_network_ipv6_destination_ht(const common::idp::updateGlo
 		request_convert.emplace_back(ipv6_address_t::convert(address), group_id);
 	}
 
-	/// ignore error
-	updater.acl.network_ipv6_destination_ht->update(request_convert, false);
+	eResult result = updater.acl.network_ipv6_destination_ht->update(request_convert);
+	if (result != eResult::success)
+	{
+		/// hosts are also in lpm
+		YANET_LOG_WARNING("acl.network.ipv6.destination_ht.update(): %s, fallback to lpm\n", result_to_c_str(result));
+
+		result = updater.acl.network_ipv6_destination_ht->update({});
+		if (result != eResult::success)
+		{
+			YANET_LOG_ERROR("acl.network.ipv6.destination_ht.update(): %s\n", result_to_c_str(result));
+			return result;
+		}
+	}
+
 	acl.network.ipv6.destination_ht = updater.acl.network_ipv6_destination_ht->pointer;
 
-	return eResult::success;
+	return result;
 }
 
 eResult generation::acl_network_ipv6_destination(const common::idp::updateGlobalBase::acl_network_ipv6_destination::request& request)
@@ -2606,6 +2737,30 @@ eResult generation::dump_tags_ids(const common::idp::updateGlobalBase::dump_tags
 	return eResult::success;
 }
 
+eResult generation::acl_meters_update(const common::idp::updateGlobalBase::acl_meters::request& request)
+{
+	if (request.size() > YANET_CONFIG_ACL_METERS_SIZE)
+	{
+		YANET_LOG_ERROR("invalid acl meters count: %lu\n", request.size());
+		return eResult::invalidCount;
+	}
+
+	/// meter rate is configured per dataplane and split between workers
+	const uint32_t workers_count = std::max(dataPlane->workers.size(), (size_t)1);
+
+	memset(acl_meters, 0, sizeof(acl_meters));
+
+	for (size_t meter_id = 0; meter_id < request.size(); meter_id++)
+	{
+		const auto& [rate, burst] = request[meter_id];
+
+		acl_meters[meter_id].rate = std::max(rate / workers_count, (uint32_t)1);
+		acl_meters[meter_id].burst = std::max(burst / workers_count, (uint32_t)1);
+	}
+
+	return eResult::success;
+}
+
 eResult generation::dregress_prefix_update(const common::idp::updateGlobalBase::dregress_prefix_update::request& request)
 {
 	eResult result = eResult::success;
@@ -2756,12 +2911,15 @@ eResult generation::update_host_config(const common::idp::updateGlobalBase::upda
 {
 	eResult result = eResult::success;
 
-	auto [ipv4_address, ipv6_address, show_real_address] = request;
+	auto [ipv4_address, ipv6_address, show_real_address, time_exceeded_rate, time_exceeded_burst, time_exceeded_ipv4_prefix, time_exceeded_ipv6_prefix] = request;
 
 	host_config = dataplane::globalBase::host_config_t{
 	        ipv4_address_t::convert(ipv4_address),
 	        ipv6_address_t::convert(ipv6_address),
-	        show_real_address};
+	        show_real_address,
+	        {time_exceeded_rate, time_exceeded_burst},
+	        time_exceeded_ipv4_prefix,
+	        time_exceeded_ipv6_prefix};
 
 	return result;
 }
@@ -12,6 +12,7 @@
 #include <chash/service.hpp>
 
 #include "common/idp.h"
+#include "common/policer.h"
 #include "common/result.h"
 #include "common/tsc_deltas.h"
 
@@ -69,7 +70,7 @@ struct transport_layer_t
 using network_ipv4_source = dataplane::updater_lpm4_24bit_8bit_id32;
 using network_ipv4_destination = dataplane::updater_lpm4_24bit_8bit_id32;
 using network_ipv6_source = YANET_CONFIG_ACL_NETWORK_LPM6_TYPE;
-using network_ipv6_destination_ht = dataplane::updater_hashtable_mod_id32<ipv6_address_t, 1>;
+using network_ipv6_destination_ht = dataplane::updater_hashtable_cuckoo_id32<ipv6_address_t>;
 using network_ipv6_destination = YANET_CONFIG_ACL_NETWORK_LPM6_TYPE;
 using network_table = dataplane::updater_dynamic_table<uint32_t>;
 using transport_layers = dataplane::updater_array<transport_layer_t>;
@@ -84,6 +85,13 @@ using lan_ht = hashtable_mod_spinlock_dynamic<nat64stateful_lan_key, nat64statef
 using wan_ht = hashtable_mod_spinlock_dynamic<nat64stateful_wan_key, nat64stateful_wan_value, 16>;
 }
 
+namespace nat64stateless
+{
+using translations = dataplane::updater_array<nat64stateless_translation_t>;
+using ingress_lookup = dataplane::updater_hashtable_mod_id32<nat64stateless_ingress_key_t, 16>;
+using egress_lookup = dataplane::updater_hashtable_mod_id32<nat64stateless_egress_key_t, 16>;
+}
+
 namespace balancer
 {
 using state_ht = hashtable_mod_spinlock_dynamic<balancer_state_key_t, balancer_state_value_t, 16, dataplane::calculate_hash_city<balancer_state_key_t>>;
@@ -230,6 +238,7 @@ protected:
 	eResult acl_total_table(const common::idp::updateGlobalBase::acl_total_table::request& request);
 	eResult acl_values(const common::idp::updateGlobalBase::acl_values::request& request);
 	eResult dump_tags_ids(const common::idp::updateGlobalBase::dump_tags_ids::request& request);
+	eResult acl_meters_update(const common::idp::updateGlobalBase::acl_meters::request& request);
 	eResult dregress_prefix_update(const common::idp::updateGlobalBase::dregress_prefix_update::request& request);
 	eResult dregress_prefix_remove(const common::idp::updateGlobalBase::dregress_prefix_remove::request& request);
 	eResult dregress_prefix_clear();
@@ -241,6 +250,7 @@ protected:
 	eResult tsc_state_update(const common::idp::updateGlobalBase::tsc_state_update::request& request);
 	eResult tscs_base_value_update(const common::idp::updateGlobalBase::tscs_base_value_update::request& request);
 	eResult update_host_config(const common::idp::updateGlobalBase::update_host_config::request& request);
+	eResult nat64stateless_lookup_update(const common::idp::updateGlobalBase::nat64stateless_lookup_update::request& request);
 
 	using RealWeight = std::pair<balancer_real_id_t, decltype(balancer_real_state_t::weight)>;
 
@@ -293,6 +303,10 @@ public: ///< @todo
 			std::unique_ptr<acl::values> values;
 		} acl;
 
+		std::unique_ptr<nat64stateless::translations> nat64stateless_translations;
+		std::unique_ptr<nat64stateless::ingress_lookup> nat64stateless_ingress_lookup;
+		std::unique_ptr<nat64stateless::egress_lookup> nat64stateless_egress_lookup;
+
 		std::unique_ptr<updater_lpm4_24bit_8bit> route_lpm4;
 		std::unique_ptr<updater_lpm6_8x16bit> route_lpm6;
 		std::unique_ptr<updater_lpm4_24bit_8bit> route_tunnel_lpm4;
@@ -309,6 +323,11 @@ public: ///< @todo
 	void* nap[1];
 	YADECAP_CACHE_ALIGNED(align12);
 
+	/// Embedded arrays below keep compile-time sizes, tables behind pointers are sized at runtime:
+	/// - logicalPorts is indexed by port and vlan of received packet without bounds check
+	/// - balancer services, reals and real states are updated in place on the active generation
+	/// - tun64tunnels, decaps, routes, interfaces and other module arrays are small
+	/// Generations do not share tables, every update is applied to each of them.
 	tLogicalPort logicalPorts[CONFIG_YADECAP_LOGICALPORTS_SIZE];
 	tDecap decaps[CONFIG_YADECAP_DECAPS_SIZE];
 	route_t routes[CONFIG_YADECAP_ROUTES_SIZE];
@@ -394,7 +413,11 @@ public: ///< @todo
 	                  4>
 	        tun64mappingsTable;
 
-	nat64stateless_translation_t nat64statelessTranslations[CONFIG_YADECAP_NAT64STATELESS_TRANSLATIONS_SIZE];
+	/// sized by highest translation id of loaded configuration
+	nat64stateless_translation_t* nat64statelessTranslations;
+	/// translation ids of flows with common::globalBase::nat64stateless_translation_lookup
+	nat64stateless::ingress_lookup::object_type* nat64stateless_ingress_lookup;
+	nat64stateless::egress_lookup::object_type* nat64stateless_egress_lookup;
 	uint32_t balancer_services_count;
 	uint32_t balancer_active_services[YANET_CONFIG_BALANCER_SERVICES_SIZE];
 	balancer_service_t balancer_services[YANET_CONFIG_BALANCER_SERVICES_SIZE];
@@ -406,6 +429,9 @@ public: ///< @todo
 
 	int64_t dump_id_to_tag[YANET_CONFIG_DUMP_ID_TO_TAG_SIZE];
 
+	/// per worker share of acl rate-limit meters
+	common::policer::rate_t acl_meters[YANET_CONFIG_ACL_METERS_SIZE];
+
 	bool tscs_active;
 	dataplane::perf::tsc_base_values tsc_base_values;
 };
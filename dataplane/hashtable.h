@@ -15,6 +15,7 @@
 
 #include "hashtable_common.h"
 
+#include "hashtable_cuckoo_id32.h"
 #include "hashtable_mod_id32_dynamic.h"
 
 namespace dataplane
@@ -2036,6 +2037,8 @@ class hashtable_mod_spinlock_dynamic
 {
 public:
 	using hashtable_t = hashtable_mod_spinlock_dynamic<key_t, value_t, chunk_size, calculate_hash>;
+	using key_type = key_t;
+	using value_type = value_t;
 
 	constexpr static uint32_t valid_mask_full = 0xFFFFFFFFu >> (32 - chunk_size);
 	constexpr static uint64_t keys_in_chunk_size = chunk_size;
@@ -0,0 +1,322 @@
+#pragma once
+
+#include <algorithm>
+#include <bitset>
+#include <cstring>
+#include <tuple>
+#include <vector>
+
+#include <emmintrin.h>
+#include <rte_prefetch.h>
+
+#include "common/result.h"
+#include "hashtable_common.h"
+
+namespace dataplane
+{
+
+/**
+ * A bucketized cuckoo hash table with a dynamically allocated size. Key is
+ * provided as a template argument, value is an unsigned 32-bit integer.
+ *
+ * Each key has two candidate buckets of `bucket_size` slots. Every slot keeps
+ * a 16-bit tag of the key hash, so lookup compares all tags of a bucket by one
+ * SIMD instruction and reads keys only for matched tags. The alternative bucket
+ * is calculated from a bucket and a tag, which allows to move keys without
+ * rehashing. Insertion searches the shortest path of moves to a free slot,
+ * that keeps load factor above 90%.
+ *
+ * @tparam key_t          The type of the keys to be stored.
+ * @tparam calculate_hash Function to calculate hash of a key
+ */
+template<typename key_t,
+         hash_function_t<key_t> calculate_hash = calculate_hash_crc<key_t>>
+class hashtable_cuckoo_id32
+{
+public:
+	using hashtable_t = hashtable_cuckoo_id32<key_t, calculate_hash>;
+
+	constexpr static uint32_t bucket_size = 8;
+	constexpr static uint32_t buckets_size_min = 16;
+	constexpr static uint32_t search_nodes_max = 256; ///< buckets visited by one insertion
+
+	struct bucket_t
+	{
+		uint16_t tags[bucket_size]; ///< zero is free slot
+		uint32_t values[bucket_size];
+		key_t keys[bucket_size];
+	};
+
+	static_assert(sizeof(uint16_t) * bucket_size == sizeof(__m128i), "tags of bucket must fit in one vector");
+
+	struct stats_t
+	{
+		uint32_t pairs_count;
+		uint32_t pairs_size;
+		uint64_t insert_failed;
+		uint64_t rewrites;
+		uint64_t moves;
+		uint32_t longest_path;
+	};
+
+	static uint64_t calculate_sizeof(const uint32_t buckets_size)
+	{
+		if (!buckets_size)
+		{
+			YANET_LOG_ERROR("wrong buckets_size: %u\n", buckets_size);
+			return 0;
+		}
+
+		if (__builtin_popcount(buckets_size) != 1)
+		{
+			YANET_LOG_ERROR("wrong buckets_size: %u is non power of 2\n", buckets_size);
+			return 0;
+		}
+
+		return sizeof(hashtable_t) + (uint64_t)buckets_size * sizeof(bucket_t);
+	}
+
+public:
+	hashtable_cuckoo_id32(const uint32_t buckets_size) :
+	        buckets_mask(buckets_size - 1)
+	{
+		memset(buckets, 0, (uint64_t)buckets_size * sizeof(bucket_t));
+	}
+
+	[[nodiscard]] uint32_t buckets_size() const
+	{
+		return buckets_mask + 1;
+	}
+
+	/**
+	 * Performs a batched lookup for multiple keys.
+	 *
+	 * Both candidate buckets of all keys are prefetched before the first compare,
+	 * so memory accesses of a burst overlap.
+	 *
+	 * @return A bitmask indicating which keys were found. A '1' in the i-th bit means success.
+	 */
+	template<unsigned int burst_size = YANET_CONFIG_BURST_SIZE>
+	uint32_t lookup(uint32_t (&hashes)[burst_size],
+	                const key_t (&keys)[burst_size],
+	                uint32_t (&values)[burst_size],
+	                const unsigned int count) const
+	{
+		std::bitset<burst_size> success_mask;
+
+		for (unsigned int i = 0; i < count; i++)
+		{
+			hashes[i] = calculate_hash(keys[i]);
+
+			const uint16_t tag = get_tag(hashes[i]);
+			const uint32_t bucket_id = hashes[i] & buckets_mask;
+			rte_prefetch0(&buckets[bucket_id]);
+			rte_prefetch0(&buckets[get_alternative(bucket_id, tag)]);
+		}
+
+		for (unsigned int i = 0; i < count; i++)
+		{
+			const uint16_t tag = get_tag(hashes[i]);
+			const uint32_t bucket_id = hashes[i] & buckets_mask;
+
+			if (lookup_bucket(buckets[bucket_id], tag, keys[i], values[i]) ||
+			    lookup_bucket(buckets[get_alternative(bucket_id, tag)], tag, keys[i], values[i]))
+			{
+				success_mask.set(i);
+			}
+		}
+
+		return success_mask.to_ulong();
+	}
+
+	eResult fill(stats_t& stats, const std::vector<std::tuple<key_t, uint32_t>>& data)
+	{
+		eResult result = eResult::success;
+		stats = {};
+
+		for (const auto& [key, value] : data)
+		{
+			eResult insert_result = insert(stats, key, value);
+			if (insert_result != eResult::success)
+			{
+				result = insert_result;
+			}
+		}
+
+		stats.pairs_size = buckets_size() * bucket_size;
+		return result;
+	}
+
+	/**
+	 * Inserts or updates a single key-value pair.
+	 *
+	 * If both candidate buckets are full, breadth-first search over alternative
+	 * buckets finds the shortest path of moves which frees a slot. Keys are moved
+	 * only when the path is found, so failed insertion keeps the table intact.
+	 *
+	 * @return eResult::success if inserted/updated, or eResult::isFull if no path was found.
+	 */
+	eResult insert(stats_t& stats,
+	               const key_t& key,
+	               const uint32_t value)
+	{
+		const uint32_t hash = calculate_hash(key);
+		const uint16_t tag = get_tag(hash);
+		const uint32_t bucket_id = hash & buckets_mask;
+		const uint32_t alternative_id = get_alternative(bucket_id, tag);
+
+		for (const uint32_t id : {bucket_id, alternative_id})
+		{
+			auto& bucket = buckets[id];
+			for (uint32_t slot_i = 0; slot_i < bucket_size; slot_i++)
+			{
+				if (bucket.tags[slot_i] == tag &&
+				    bucket.keys[slot_i] == key)
+				{
+					bucket.values[slot_i] = value;
+					stats.rewrites++;
+					return eResult::success;
+				}
+			}
+		}
+
+		struct node_t
+		{
+			uint32_t bucket_id;
+			int parent; ///< -1 for candidate buckets of key
+			uint32_t slot; ///< slot of parent bucket, whose key moves to this bucket
+		};
+
+		node_t nodes[search_nodes_max];
+		uint32_t nodes_count = 0;
+
+		nodes[nodes_count++] = {bucket_id, -1, 0};
+		if (alternative_id != bucket_id)
+		{
+			nodes[nodes_count++] = {alternative_id, -1, 0};
+		}
+
+		for (uint32_t node_i = 0; node_i < nodes_count; node_i++)
+		{
+			const auto& bucket = buckets[nodes[node_i].bucket_id];
+
+			for (uint32_t slot_i = 0; slot_i < bucket_size; slot_i++)
+			{
+				if (bucket.tags[slot_i] == 0)
+				{
+					insert_path(stats, nodes, node_i, slot_i, tag, key, value);
+					return eResult::success;
+				}
+			}
+
+			for (uint32_t slot_i = 0;
+			     slot_i < bucket_size && nodes_count < search_nodes_max;
+			     slot_i++)
+			{
+				const uint32_t next_id = get_alternative(nodes[node_i].bucket_id, bucket.tags[slot_i]);
+
+				bool visited = false;
+				for (uint32_t visited_i = 0; visited_i < nodes_count; visited_i++)
+				{
+					if (nodes[visited_i].bucket_id == next_id)
+					{
+						visited = true;
+						break;
+					}
+				}
+
+				if (!visited)
+				{
+					nodes[nodes_count++] = {next_id, (int)node_i, slot_i};
+				}
+			}
+		}
+
+		stats.insert_failed++;
+		return eResult::isFull;
+	}
+
+protected:
+	template<typename node_t>
+	void insert_path(stats_t& stats,
+	                 const node_t* nodes,
+	                 uint32_t node_i,
+	                 uint32_t slot_i,
+	                 const uint16_t tag,
+	                 const key_t& key,
+	                 const uint32_t value)
+	{
+		uint32_t path_length = 1;
+
+		/// move keys from the end of path, each move frees slot for previous one
+		while (nodes[node_i].parent >= 0)
+		{
+			const auto& node = nodes[node_i];
+			auto& from = buckets[nodes[node.parent].bucket_id];
+			auto& to = buckets[node.bucket_id];
+
+			to.tags[slot_i] = from.tags[node.slot];
+			to.values[slot_i] = from.values[node.slot];
+			to.keys[slot_i] = from.keys[node.slot];
+
+			slot_i = node.slot;
+			node_i = node.parent;
+
+			stats.moves++;
+			path_length++;
+		}
+
+		auto& bucket = buckets[nodes[node_i].bucket_id];
+		bucket.tags[slot_i] = tag;
+		bucket.values[slot_i] = value;
+		bucket.keys[slot_i] = key;
+
+		stats.pairs_count++;
+		stats.longest_path = std::max(stats.longest_path, path_length);
+	}
+
+	static inline uint16_t get_tag(const uint32_t hash)
+	{
+		const uint16_t tag = hash >> 16;
+		return tag ? tag : 1;
+	}
+
+	/// symmetric: alternative of alternative bucket is the bucket itself
+	inline uint32_t get_alternative(const uint32_t bucket_id, const uint16_t tag) const
+	{
+		return (bucket_id ^ (tag * 0x5BD1E995u)) & buckets_mask;
+	}
+
+	static inline bool lookup_bucket(const bucket_t& bucket,
+	                                 const uint16_t tag,
+	                                 const key_t& key,
+	                                 uint32_t& value)
+	{
+		const __m128i tags = _mm_loadu_si128((const __m128i*)bucket.tags);
+
+		/// two bits per matched slot
+		uint32_t matches = _mm_movemask_epi8(_mm_cmpeq_epi16(tags, _mm_set1_epi16(tag)));
+		while (matches)
+		{
+			const uint32_t slot_i = __builtin_ctz(matches) >> 1;
+			if (bucket.keys[slot_i] == key)
+			{
+				value = bucket.values[slot_i];
+				return true;
+			}
+
+			matches &= ~(3u << (slot_i << 1));
+		}
+
+		return false;
+	}
+
+protected:
+	uint32_t buckets_mask;
+
+	YADECAP_CACHE_ALIGNED(align1);
+
+	bucket_t buckets[];
+};
+
+} // namespace dataplane
@@ -83,19 +83,10 @@ inline bool yanet_icmp_translate_v4_to_v6(icmp_header_t* icmpHeader,
 namespace yanet::icmp
 {
 
-enum class TypePackage
-{
-	TimeExceeded = 0
-};
-
-struct CreateTimeExceededPackagePayload
-{
-	rte_mbuf* mbuf_source;
-	const dataplane::globalBase::host_config_t host_config;
-};
-
-using CreatePackagePayload = std::variant<CreateTimeExceededPackagePayload>;
-
-uint32_t create_icmp_package(TypePackage type, rte_mbuf* mbuf_target, const CreatePackagePayload& payload);
-uint32_t create_icmp_package_time_exceeded(rte_mbuf* mbuf_target, const CreateTimeExceededPackagePayload& payload);
+/// Rewrites packet with expired ttl to icmp time exceeded in place.
+///
+/// Ethernet header is moved to headroom, new ip and icmp headers are placed in
+/// front of original ip header, which is quoted with the beginning of payload.
+/// @return 0 on success, packet is untouched otherwise
+uint32_t rewrite_icmp_package_time_exceeded(rte_mbuf* mbuf, const dataplane::globalBase::host_config_t& host_config);
 }
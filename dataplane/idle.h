@@ -0,0 +1,67 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+namespace dataplane::idle
+{
+
+/// Waits shorter than this are spun on TSC instead of nanosleep.
+constexpr uint32_t spin_us_max = 10;
+
+/// Backoff of a polling loop without traffic, disabled if `polls` is zero.
+///
+/// The loop polls at full speed for `polls` empty iterations, then sleeps
+/// between iterations. Sleep starts from 1us and doubles up to `sleep_max_us`.
+/// Any traffic resets the backoff.
+///
+/// Wake-up latency is `sleep_max_us` plus nanosleep overshoot: timer slack of
+/// the thread (50us by default, workers set it to 1ns) and scheduler wake-up,
+/// a few microseconds on an isolated core.
+class backoff_t
+{
+public:
+	void init(const uint32_t polls, const uint32_t sleep_max_us)
+	{
+		this->polls = polls;
+		this->sleep_max_us = std::max(sleep_max_us, (uint32_t)1);
+		busy();
+	}
+
+	[[nodiscard]] bool enabled() const
+	{
+		return polls != 0;
+	}
+
+	inline void busy()
+	{
+		idle_polls = 0;
+		sleep_us = 0;
+	}
+
+	/// Returns microseconds to sleep before next iteration, zero means poll again.
+	inline uint32_t idle()
+	{
+		if (!enabled())
+		{
+			return 0;
+		}
+
+		if (idle_polls < polls)
+		{
+			idle_polls++;
+			return 0;
+		}
+
+		sleep_us = sleep_us ? std::min(sleep_us * 2, sleep_max_us) : 1;
+		return sleep_us;
+	}
+
+protected:
+	uint32_t polls{};
+	uint32_t sleep_max_us{1};
+	uint32_t idle_polls{};
+	uint32_t sleep_us{};
+};
+
+}
@@ -3,6 +3,7 @@
 #include <netinet/icmp6.h>
 #include <netinet/ip_icmp.h>
 #include <rte_config.h>
+#include <rte_icmp.h>
 #include <rte_ip.h>
 #include <rte_tcp.h>
 #include <rte_udp.h>
@@ -38,6 +39,7 @@ struct metadata
 };
 
 static_assert(sizeof(metadata) + sizeof(rte_ipv6_hdr) ///< encap
+                              + sizeof(rte_ipv6_hdr) + sizeof(rte_icmp_hdr) ///< icmp error in place (yanet::icmp)
                               + sizeof(rte_ipv6_hdr) + sizeof(rte_udp_hdr) + YADECAP_MPLS_HEADER_SIZE ///< route tunnel
                               + (2 * YADECAP_MPLS_HEADER_SIZE) ///< route
                               + 4 ///< vlan
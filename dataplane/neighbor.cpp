@@ -6,6 +6,7 @@
 
 #include "base.h"
 #include "neighbor.h"
+#include "sdpserver.h"
 
 namespace dataplane::neighbor
 {
@@ -59,6 +60,11 @@ void module::update_worker_base(const std::vector<std::tuple<tSocketId, dataplan
 	}
 }
 
+void module::SetBufferForTables(const common::sdp::DataPlaneInSharedMemory& sdp_data)
+{
+	this->sdp_data = &sdp_data;
+}
+
 common::idp::neighbor_show::response module::neighbor_show() const
 {
 	common::idp::neighbor_show::response response;
@@ -242,9 +248,68 @@ eResult module::neighbor_flush()
 	generation_hashtable.switch_generation_with_update([this]() {
 		on_neighbor_flush_handle_();
 	});
+	/// published by resolve job, bursts of netlink events result in one write
+	sdp_dirty = true;
 	return eResult::success;
 }
 
+void module::PublishToSharedMemory()
+{
+	if (sdp_data == nullptr)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> guard(sdp_mutex);
+
+	generation_interface.current_lock();
+	auto interface_id_to_name = generation_interface.current().interface_id_to_name;
+	generation_interface.current_unlock();
+
+	std::vector<common::sdp::NeighborEntry> entries;
+	{
+		auto lock = generation_hashtable.current_lock_guard();
+
+		const auto& hashtable_updaters = generation_hashtable.current().hashtable_updater;
+		if (hashtable_updaters.empty())
+		{
+			return;
+		}
+
+		const auto& hashtable_updater = hashtable_updaters.begin()->second;
+		for (auto iter : hashtable_updater.range())
+		{
+			if (!iter.is_valid())
+			{
+				continue;
+			}
+
+			auto& key = *iter.key();
+			auto& value = *iter.value();
+
+			auto it = interface_id_to_name.find(key.interface_id);
+			if (it == interface_id_to_name.end())
+			{
+				continue;
+			}
+
+			const auto& [route_name, interface_name] = it->second;
+
+			auto& entry = entries.emplace_back();
+			memset(&entry, 0, sizeof(entry));
+			snprintf(entry.route_name, sizeof(entry.route_name), "%s", route_name.data());
+			snprintf(entry.interface_name, sizeof(entry.interface_name), "%s", interface_name.data());
+			memcpy(entry.address, key.address.bytes, sizeof(entry.address));
+			memcpy(entry.mac_address, value.ether_address.addr_bytes, sizeof(entry.mac_address));
+			entry.flags |= (key.flags & flag_is_ipv6) ? common::sdp::NeighborEntry::flag_is_ipv6 : 0;
+			entry.flags |= (value.flags & flag_is_static) ? common::sdp::NeighborEntry::flag_is_static : 0;
+			entry.last_update_timestamp = value.last_update_timestamp;
+		}
+	}
+
+	common::sdp::SdrSever::WriteNeighborTable(*sdp_data, entries, current_time_provider_());
+}
+
 void module::StartNetlinkMonitor()
 {
 	neighbor_provider->StartMonitor(
@@ -398,6 +463,11 @@ void module::StartResolveJob()
 			resolve(key);
 		}
 
+		if (sdp_dirty.exchange(false))
+		{
+			PublishToSharedMemory();
+		}
+
 		std::this_thread::sleep_for(std::chrono::milliseconds(PAUSE));
 		return true;
 	});
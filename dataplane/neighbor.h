@@ -11,6 +11,7 @@
 #include "common/generation.h"
 #include "common/idp.h"
 #include "common/neighbor.h"
+#include "common/sdpcommon.h"
 #include "common/utils.h"
 
 #include "hashtable.h"
@@ -82,6 +83,10 @@ public:
 
 	void update_worker_base(const std::vector<std::tuple<tSocketId, dataplane::base::generation*>>& base_nexts);
 
+	/// Neighbor table is published to the TABLES section of shared memory by the resolve job,
+	/// at most once per PAUSE after flushes.
+	void SetBufferForTables(const common::sdp::DataPlaneInSharedMemory& sdp_data);
+
 	common::idp::neighbor_show::response neighbor_show() const;
 	eResult neighbor_insert(const common::idp::neighbor_insert::request& request);
 	eResult neighbor_remove(const common::idp::neighbor_remove::request& request);
@@ -101,6 +106,7 @@ protected:
 	void StartNetlinkMonitor();
 	void StopNetlinkMonitor();
 	eResult DumpOSNeighbors();
+	void PublishToSharedMemory();
 
 	void resolve(const dataplane::neighbor::key& key);
 
@@ -110,6 +116,10 @@ protected:
 
 	common::neighbor::stats stats;
 
+	const common::sdp::DataPlaneInSharedMemory* sdp_data = nullptr;
+	std::mutex sdp_mutex;
+	std::atomic<bool> sdp_dirty{};
+
 	std::function<std::uint32_t()> current_time_provider_;
 	std::function<void()> on_neighbor_flush_handle_;
 	std::function<std::vector<dataplane::neighbor::key>()> keys_to_resolve_provider_;
@@ -0,0 +1,395 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include <rte_hash_crc.h>
+
+#include "common/define.h"
+#include "common/policer.h"
+
+#include "type.h"
+
+namespace dataplane::policer
+{
+
+using class_e = common::policer::class_e;
+using rate_t = common::policer::rate_t;
+using config_t = common::policer::config_t;
+
+/// Token bucket with lazy TSC-based refill.
+///
+/// Tokens are accounted only when the bucket runs dry, so a bucket that is
+/// never exhausted costs a single decrement per packet.
+class bucket_t
+{
+public:
+	void init(const rate_t& rate, const uint64_t hz, const uint64_t tsc)
+	{
+		cycles_per_token = rate.rate ? std::max(hz / rate.rate, (uint64_t)1) : 0;
+		burst = std::max(rate.burst, rate.rate ? (uint32_t)1 : 0);
+		tokens = burst;
+		last_tsc = tsc;
+	}
+
+	[[nodiscard]] bool unlimited() const
+	{
+		return cycles_per_token == 0;
+	}
+
+	inline bool consume(const uint64_t tsc)
+	{
+		if (unlimited())
+		{
+			return true;
+		}
+
+		if (unlikely(tokens == 0))
+		{
+			uint64_t refill = (tsc - last_tsc) / cycles_per_token;
+			if (refill == 0)
+			{
+				return false;
+			}
+
+			if (refill >= burst)
+			{
+				tokens = burst;
+				last_tsc = tsc;
+			}
+			else
+			{
+				tokens = refill;
+				last_tsc += refill * cycles_per_token;
+			}
+		}
+
+		tokens--;
+		return true;
+	}
+
+public:
+	uint64_t cycles_per_token{};
+	uint64_t last_tsc{};
+	uint32_t burst{};
+	uint32_t tokens{};
+};
+
+/// Bucket which follows updates of its rate, used for acl rate-limit meters.
+class meter_t
+{
+public:
+	inline bool consume(const rate_t& rate, const uint64_t hz, const uint64_t tsc)
+	{
+		if (unlikely(rate.rate != current.rate || rate.burst != current.burst))
+		{
+			current = rate;
+			bucket.init(rate, hz, tsc);
+		}
+
+		return bucket.consume(tsc);
+	}
+
+protected:
+	rate_t current;
+	bucket_t bucket;
+};
+
+inline void mask_prefix(ipv6_address_t& prefix, const uint8_t mask)
+{
+	for (uint8_t byte_i = 0;
+	     byte_i < 16;
+	     byte_i++)
+	{
+		if (mask <= byte_i * 8)
+		{
+			prefix.bytes[byte_i] = 0;
+		}
+		else if (mask < (byte_i + 1) * 8)
+		{
+			prefix.bytes[byte_i] &= (uint8_t)(0xFFu << ((byte_i + 1) * 8 - mask));
+		}
+	}
+}
+
+/// Limiter of icmp errors generated by one worker, per source prefix.
+///
+/// Prefixes are hashed to a fixed number of meters without keys: colliding
+/// prefixes share one meter, which only makes the limit stricter.
+class icmp_limiter_t
+{
+public:
+	constexpr static uint32_t meters_size = 1024;
+
+	inline bool consume_ipv4(const rate_t& rate,
+	                         const uint8_t mask,
+	                         const uint32_t address,
+	                         const uint64_t hz,
+	                         const uint64_t tsc)
+	{
+		ipv6_address_t prefix;
+		prefix.reset();
+		prefix.mapped_ipv4_address.address = address;
+		return consume(rate, prefix, 96 + mask, hz, tsc);
+	}
+
+	inline bool consume_ipv6(const rate_t& rate,
+	                         const uint8_t mask,
+	                         const uint8_t* address,
+	                         const uint64_t hz,
+	                         const uint64_t tsc)
+	{
+		ipv6_address_t prefix;
+		memcpy(prefix.bytes, address, 16);
+		return consume(rate, prefix, mask, hz, tsc);
+	}
+
+protected:
+	inline bool consume(const rate_t& rate,
+	                    ipv6_address_t& prefix,
+	                    const uint8_t mask,
+	                    const uint64_t hz,
+	                    const uint64_t tsc)
+	{
+		if (!rate.rate)
+		{
+			return true;
+		}
+
+		mask_prefix(prefix, mask);
+
+		uint32_t hash = rte_hash_crc(prefix.bytes, sizeof(prefix.bytes), 0);
+		return meters[hash & (meters_size - 1)].consume(rate, hz, tsc);
+	}
+
+protected:
+	meter_t meters[meters_size];
+};
+
+struct source_bucket_t
+{
+	ipv6_address_t prefix;
+	uint8_t class_id;
+	uint8_t valid;
+	bucket_t bucket;
+	uint64_t last_seen;
+	uint64_t drops;
+} __rte_aligned(RTE_CACHE_LINE_SIZE);
+
+/// Source key: IPv4 addresses are stored as IPv4-mapped, non-IP packets
+/// are keyed by source MAC address.
+struct source_t
+{
+	ipv6_address_t address;
+	uint8_t mask;
+};
+
+struct top_source_t
+{
+	class_e class_id;
+	ipv6_address_t prefix;
+	uint64_t drops;
+};
+
+/// Two-level (class, class + source) policer owned by one worker.
+///
+/// Sources live in a compact open-addressing table of cache-line sized
+/// buckets, probed in groups of `group_size`. When a group is full the
+/// least recently seen bucket is evicted.
+class policer_t
+{
+public:
+	constexpr static uint32_t group_size = 4;
+
+	enum class result_e : uint8_t
+	{
+		pass,
+		class_drop,
+		source_drop
+	};
+
+	/// Buckets are provided by the owner (hugepage memory of the worker's socket).
+	void init(const config_t& config,
+	          source_bucket_t* buckets,
+	          const uint32_t buckets_size,
+	          const uint64_t hz,
+	          const uint64_t tsc)
+	{
+		this->config = config;
+		this->buckets = buckets;
+		this->buckets_mask = buckets_size - group_size;
+		this->hz = hz;
+
+		for (uint8_t class_i = 0;
+		     class_i < (uint8_t)class_e::size;
+		     class_i++)
+		{
+			aggregates[class_i].init(config.classes[class_i].aggregate, hz, tsc);
+		}
+
+		std::fill(buckets, buckets + buckets_size, source_bucket_t{});
+	}
+
+	[[nodiscard]] bool enabled() const
+	{
+		return buckets != nullptr;
+	}
+
+	/// Rounds requested table size up to power of 2, not less than group size.
+	static uint32_t calculate_buckets_size(const uint32_t table_size)
+	{
+		uint32_t size = group_size;
+		while (size < table_size)
+		{
+			size <<= 1;
+		}
+		return size;
+	}
+
+	inline result_e check(const class_e class_id,
+	                      const source_t& source,
+	                      const uint64_t tsc)
+	{
+		const auto& class_config = config.classes[(uint8_t)class_id];
+
+		if (class_config.source.rate)
+		{
+			source_bucket_t* source_bucket = lookup(class_id, source, tsc);
+			source_bucket->last_seen = tsc;
+			if (!source_bucket->bucket.consume(tsc))
+			{
+				source_bucket->drops++;
+				return result_e::source_drop;
+			}
+		}
+
+		if (!aggregates[(uint8_t)class_id].consume(tsc))
+		{
+			return result_e::class_drop;
+		}
+
+		return result_e::pass;
+	}
+
+	[[nodiscard]] source_t source_ipv4(const uint32_t address) const
+	{
+		source_t source;
+		source.address.reset();
+		source.address.mapped_ipv4_address.address = address;
+		source.mask = 96 + config.ipv4_prefix;
+		return source;
+	}
+
+	[[nodiscard]] source_t source_ipv6(const uint8_t* address) const
+	{
+		source_t source;
+		memcpy(source.address.bytes, address, 16);
+		source.mask = config.ipv6_prefix;
+		return source;
+	}
+
+	[[nodiscard]] source_t source_ether(const uint8_t* address) const
+	{
+		source_t source;
+		source.address.reset();
+		source.address.bytes[8] = 0xFF;
+		memcpy(&source.address.bytes[10], address, 6);
+		source.mask = 128;
+		return source;
+	}
+
+	[[nodiscard]] uint64_t get_evictions() const
+	{
+		return evictions;
+	}
+
+	/// Not synchronized with the worker: values may be slightly stale.
+	[[nodiscard]] std::vector<top_source_t> top_sources(const uint32_t limit) const
+	{
+		std::vector<top_source_t> result;
+		if (!enabled())
+		{
+			return result;
+		}
+
+		for (uint32_t bucket_i = 0;
+		     bucket_i < buckets_mask + group_size;
+		     bucket_i++)
+		{
+			const auto& source_bucket = buckets[bucket_i];
+			if (source_bucket.valid && source_bucket.drops)
+			{
+				result.emplace_back(top_source_t{(class_e)source_bucket.class_id,
+				                                 source_bucket.prefix,
+				                                 source_bucket.drops});
+			}
+		}
+
+		/// only top of sources is reported, rest of them are left unsorted
+		const auto top_end = result.begin() + std::min((size_t)limit, result.size());
+		std::partial_sort(result.begin(), top_end, result.end(), [](const top_source_t& a, const top_source_t& b) {
+			return a.drops > b.drops;
+		});
+		result.erase(top_end, result.end());
+
+		return result;
+	}
+
+protected:
+	inline source_bucket_t* lookup(const class_e class_id,
+	                               const source_t& source,
+	                               const uint64_t tsc)
+	{
+		ipv6_address_t prefix = source.address;
+		mask_prefix(prefix, source.mask);
+
+		uint32_t hash = rte_hash_crc(prefix.bytes, sizeof(prefix.bytes), (uint32_t)class_id);
+		source_bucket_t* group = &buckets[(hash * group_size) & buckets_mask];
+
+		source_bucket_t* victim = &group[0];
+		for (uint32_t slot_i = 0;
+		     slot_i < group_size;
+		     slot_i++)
+		{
+			source_bucket_t* source_bucket = &group[slot_i];
+			if (!source_bucket->valid)
+			{
+				victim = source_bucket;
+				break;
+			}
+
+			if (source_bucket->class_id == (uint8_t)class_id &&
+			    source_bucket->prefix == prefix)
+			{
+				return source_bucket;
+			}
+
+			if (source_bucket->last_seen < victim->last_seen)
+			{
+				victim = source_bucket;
+			}
+		}
+
+		if (victim->valid)
+		{
+			evictions++;
+		}
+
+		victim->prefix = prefix;
+		victim->class_id = (uint8_t)class_id;
+		victim->valid = 1;
+		victim->bucket.init(config.classes[(uint8_t)class_id].source, hz, tsc);
+		victim->drops = 0;
+		return victim;
+	}
+
+protected:
+	config_t config;
+	bucket_t aggregates[(uint8_t)class_e::size];
+	source_bucket_t* buckets{};
+	uint32_t buckets_mask{};
+	uint64_t hz{};
+	uint64_t evictions{};
+};
+
+}
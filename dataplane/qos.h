@@ -0,0 +1,358 @@
+#pragma once
+
+#include <algorithm>
+
+#include <rte_byteorder.h>
+#include <rte_ether.h>
+#include <rte_ip.h>
+#include <rte_mbuf.h>
+
+#include "common/define.h"
+#include "common/qos.h"
+
+namespace dataplane::qos
+{
+
+using class_config_t = common::qos::class_config_t;
+using port_config_t = common::qos::port_config_t;
+
+/// Single producer, single consumer ring of mbufs owned by one worker.
+class queue_t
+{
+public:
+	void init(rte_mbuf** mbufs, const uint32_t size)
+	{
+		this->mbufs = mbufs;
+		this->mask = size - 1;
+		head = 0;
+		tail = 0;
+	}
+
+	[[nodiscard]] inline uint32_t size() const
+	{
+		return tail - head;
+	}
+
+	[[nodiscard]] inline bool empty() const
+	{
+		return tail == head;
+	}
+
+	inline bool push(rte_mbuf* mbuf)
+	{
+		if (unlikely(size() > mask))
+		{
+			return false;
+		}
+
+		mbufs[tail++ & mask] = mbuf;
+		return true;
+	}
+
+	[[nodiscard]] inline rte_mbuf* front() const
+	{
+		return mbufs[head & mask];
+	}
+
+	inline void pop()
+	{
+		head++;
+	}
+
+protected:
+	rte_mbuf** mbufs{};
+	uint32_t mask{};
+	uint32_t head{};
+	uint32_t tail{};
+};
+
+/// Byte credits of port shaping, refilled by TSC.
+class shaper_t
+{
+public:
+	void init(const uint64_t rate, const uint32_t burst, const uint64_t hz, const uint64_t tsc)
+	{
+		this->rate = rate;
+		this->burst = std::max((uint64_t)burst, (uint64_t)RTE_ETHER_MAX_LEN);
+		this->hz = hz;
+		credits = this->burst;
+		last_tsc = tsc;
+	}
+
+	/// A packet is sent while credits are positive, so a port never stalls
+	/// on packets larger than burst.
+	inline bool consume(const uint32_t bytes, const uint64_t tsc)
+	{
+		if (!rate)
+		{
+			return true;
+		}
+
+		if (credits <= 0)
+		{
+			uint64_t refill = (unsigned __int128)(tsc - last_tsc) * rate / hz;
+			if (refill == 0)
+			{
+				return false;
+			}
+
+			credits = std::min(credits + (int64_t)std::min(refill, burst), (int64_t)burst);
+			last_tsc = tsc;
+
+			if (credits <= 0)
+			{
+				return false;
+			}
+		}
+
+		credits -= bytes;
+		return true;
+	}
+
+protected:
+	uint64_t rate{};
+	uint64_t burst{};
+	uint64_t hz{};
+	int64_t credits{};
+	uint64_t last_tsc{};
+};
+
+struct class_stats_t
+{
+	uint64_t packets;
+	uint64_t bytes;
+	uint64_t drops;
+};
+
+/// Egress scheduler of one physical port owned by one worker.
+///
+/// Packets are classified by DSCP into software queues. Classes are served
+/// in strict priority order, classes of the same priority share the port by
+/// weighted round robin. Port rate is limited by a byte shaper.
+class scheduler_t
+{
+public:
+	/// Sum of queue sizes, storage is provided by the owner.
+	static uint32_t calculate_storage_size(const port_config_t& config)
+	{
+		uint32_t result = 0;
+		for (uint8_t class_i = 0;
+		     class_i < config.classes_count;
+		     class_i++)
+		{
+			result += calculate_queue_size(config.classes[class_i].queue_size);
+		}
+		return result;
+	}
+
+	void init(const port_config_t& config,
+	          rte_mbuf** storage,
+	          const uint64_t hz,
+	          const uint64_t tsc)
+	{
+		this->config = config;
+
+		for (uint8_t class_i = 0;
+		     class_i < config.classes_count;
+		     class_i++)
+		{
+			uint32_t queue_size = calculate_queue_size(config.classes[class_i].queue_size);
+			queues[class_i].init(storage, queue_size);
+			storage += queue_size;
+
+			deficits[class_i] = std::max(config.classes[class_i].weight, (uint16_t)1);
+			order[class_i] = class_i;
+		}
+
+		/// stable: classes of the same priority keep configuration order
+		std::stable_sort(order, order + config.classes_count, [&config](const uint8_t a, const uint8_t b) {
+			return config.classes[a].priority < config.classes[b].priority;
+		});
+
+		levels_count = 0;
+		for (uint8_t order_i = 0;
+		     order_i < config.classes_count;
+		     order_i++)
+		{
+			if (order_i == 0 ||
+			    config.classes[order[order_i]].priority != config.classes[order[order_i - 1]].priority)
+			{
+				levels[levels_count++] = {order_i, order_i, order_i};
+			}
+
+			levels[levels_count - 1].end = order_i + 1;
+		}
+
+		shaper.init(config.rate, config.burst, hz, tsc);
+		queued = 0;
+	}
+
+	[[nodiscard]] bool enabled() const
+	{
+		return config.enabled();
+	}
+
+	[[nodiscard]] inline bool empty() const
+	{
+		return queued == 0;
+	}
+
+	/// Returns false if class queue is full, mbuf is not consumed then.
+	inline bool enqueue(rte_mbuf* mbuf)
+	{
+		uint8_t class_id = config.dscp_to_class[get_dscp(mbuf)];
+		if (unlikely(!queues[class_id].push(mbuf)))
+		{
+			stats[class_id].drops++;
+			return false;
+		}
+
+		queued++;
+		return true;
+	}
+
+	/// Fills up to `size` mbufs allowed by the shaper.
+	inline uint16_t dequeue(rte_mbuf** mbufs, const uint16_t size, const uint64_t tsc)
+	{
+		uint16_t count = 0;
+		while (count < size && queued)
+		{
+			uint8_t class_id = pick();
+			rte_mbuf* mbuf = queues[class_id].front();
+			if (!shaper.consume(mbuf->pkt_len, tsc))
+			{
+				/// credit is not spent
+				deficits[class_id]++;
+				break;
+			}
+
+			queues[class_id].pop();
+			queued--;
+
+			stats[class_id].packets++;
+			stats[class_id].bytes += mbuf->pkt_len;
+			mbufs[count++] = mbuf;
+		}
+
+		return count;
+	}
+
+	[[nodiscard]] uint8_t get_classes_count() const
+	{
+		return config.classes_count;
+	}
+
+	/// Not synchronized with the worker: values may be slightly stale.
+	[[nodiscard]] const class_stats_t& get_stats(const uint8_t class_id) const
+	{
+		return stats[class_id];
+	}
+
+	[[nodiscard]] uint32_t get_queue_size(const uint8_t class_id) const
+	{
+		return queues[class_id].size();
+	}
+
+	static uint8_t get_dscp(const rte_mbuf* mbuf)
+	{
+		const auto* ethernetHeader = rte_pktmbuf_mtod(mbuf, const rte_ether_hdr*);
+		uint16_t ether_type = ethernetHeader->ether_type;
+		uint32_t offset = sizeof(rte_ether_hdr);
+
+		if (ether_type == rte_cpu_to_be_16(RTE_ETHER_TYPE_VLAN))
+		{
+			const auto* vlanHeader = rte_pktmbuf_mtod_offset(mbuf, const rte_vlan_hdr*, offset);
+			ether_type = vlanHeader->eth_proto;
+			offset += sizeof(rte_vlan_hdr);
+		}
+
+		if (ether_type == rte_cpu_to_be_16(RTE_ETHER_TYPE_IPV4))
+		{
+			const auto* ipv4Header = rte_pktmbuf_mtod_offset(mbuf, const rte_ipv4_hdr*, offset);
+			return ipv4Header->type_of_service >> 2;
+		}
+		else if (ether_type == rte_cpu_to_be_16(RTE_ETHER_TYPE_IPV6))
+		{
+			const auto* ipv6Header = rte_pktmbuf_mtod_offset(mbuf, const rte_ipv6_hdr*, offset);
+			return (rte_be_to_cpu_32(ipv6Header->vtc_flow) >> 22) & 0x3F;
+		}
+
+		return 0;
+	}
+
+protected:
+	static uint32_t calculate_queue_size(const uint32_t queue_size)
+	{
+		uint32_t size = 1;
+		while (size < queue_size)
+		{
+			size <<= 1;
+		}
+		return size;
+	}
+
+	/// Called only when at least one queue is not empty.
+	inline uint8_t pick()
+	{
+		for (uint8_t level_i = 0;
+		     level_i < levels_count;
+		     level_i++)
+		{
+			auto& level = levels[level_i];
+
+			bool found = false;
+			for (uint8_t order_i = level.begin;
+			     order_i < level.end;
+			     order_i++)
+			{
+				if (!queues[order[order_i]].empty())
+				{
+					found = true;
+					break;
+				}
+			}
+
+			if (!found)
+			{
+				continue;
+			}
+
+			/// weighted round robin: class keeps the turn until it spends its
+			/// weight or becomes empty
+			for (;;)
+			{
+				uint8_t class_id = order[level.current];
+				if (!queues[class_id].empty() && deficits[class_id])
+				{
+					deficits[class_id]--;
+					return class_id;
+				}
+
+				deficits[class_id] = std::max(config.classes[class_id].weight, (uint16_t)1);
+				level.current = level.current + 1 < level.end ? level.current + 1 : level.begin;
+			}
+		}
+
+		return 0;
+	}
+
+protected:
+	struct level_t
+	{
+		uint8_t begin;
+		uint8_t end;
+		uint8_t current;
+	};
+
+	port_config_t config;
+	queue_t queues[YANET_CONFIG_QOS_CLASSES_SIZE];
+	uint16_t deficits[YANET_CONFIG_QOS_CLASSES_SIZE]{};
+	uint8_t order[YANET_CONFIG_QOS_CLASSES_SIZE]{};
+	level_t levels[YANET_CONFIG_QOS_CLASSES_SIZE]{};
+	uint8_t levels_count{};
+	uint32_t queued{};
+	shaper_t shaper;
+	class_stats_t stats[YANET_CONFIG_QOS_CLASSES_SIZE]{};
+};
+
+}
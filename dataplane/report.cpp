@@ -58,7 +58,8 @@ void to_json(nlohmann::json& j, const stats_t& stats)
 } // namespace common::dregress
 
 cReport::cReport(cDataPlane* dataPlane) :
-        dataPlane(dataPlane)
+        dataPlane(dataPlane),
+        globalBaseTablesSerial(0)
 {
 }
 
@@ -90,6 +91,12 @@ nlohmann::json cReport::getReport()
 
 	{
 		std::lock_guard<std::mutex> guard(dataPlane->currentGlobalBaseId_mutex);
+		if (globalBaseTablesSerial != dataPlane->globalBaseSerial)
+		{
+			globalBaseTables.clear();
+			globalBaseTablesSerial = dataPlane->globalBaseSerial;
+		}
+
 		for (const auto& iter : dataPlane->globalBases)
 		{
 			jsonReport["globalBases"].emplace_back(convertGlobalBase(iter.second[dataPlane->currentGlobalBaseId]));
@@ -102,6 +109,14 @@ nlohmann::json cReport::getReport()
 	dataPlane->neighbor.report(jsonReport);
 	dataPlane->memory_manager.report(jsonReport);
 
+	for (const auto& [phase, duration] : dataPlane->startup_timings)
+	{
+		nlohmann::json json;
+		json["phase"] = phase;
+		json["ms"] = duration;
+		jsonReport["startup_timings"].emplace_back(json);
+	}
+
 	return jsonReport;
 }
 
@@ -134,6 +149,10 @@ nlohmann::json cReport::convertWorker(const cWorker* worker)
 	json["coreId"] = worker->coreId;
 	json["socketId"] = worker->socketId;
 	json["mempool"] = convertMempool(worker->mempool);
+	if (worker->mempool_small)
+	{
+		json["mempool_small"] = convertMempool(worker->mempool_small);
+	}
 	json["iteration"] = worker->iteration;
 
 	json["stats"]["brokenPackets"] = worker->stats->brokenPackets;
@@ -167,6 +186,9 @@ nlohmann::json cReport::convertWorker(const cWorker* worker)
 	json["stats"]["samples_drops"] = worker->sampler.get_drops();
 	json["stats"]["logs_packets"] = worker->stats->logs_packets;
 	json["stats"]["logs_drops"] = worker->stats->logs_drops;
+	json["stats"]["idle_iterations"] = worker->stats->idle_iterations;
+	json["stats"]["idle_sleep_us"] = worker->stats->idle_sleep_us;
+	json["stats"]["repeat_packets"] = worker->stats->repeat_packets;
 
 	for (tPortId portId = 0;
 	     portId < dataPlane->ports.size();
@@ -178,6 +200,23 @@ nlohmann::json cReport::convertWorker(const cWorker* worker)
 		jsonPort["physicalPort_egress_drops"] = worker->statsPorts[portId].physicalPort_egress_drops;
 		jsonPort["controlPlane_drops"] = 0; // @todo: DELETE
 
+		const auto& scheduler = worker->qos_schedulers[portId];
+		for (uint8_t class_id = 0;
+		     class_id < scheduler.get_classes_count();
+		     class_id++)
+		{
+			const auto& class_stats = scheduler.get_stats(class_id);
+
+			nlohmann::json jsonClass;
+			jsonClass["class"] = class_id;
+			jsonClass["packets"] = class_stats.packets;
+			jsonClass["bytes"] = class_stats.bytes;
+			jsonClass["drops"] = class_stats.drops;
+			jsonClass["queue_size"] = scheduler.get_queue_size(class_id);
+
+			jsonPort["qos"].emplace_back(jsonClass);
+		}
+
 		json["statsPorts"].emplace_back(jsonPort);
 	}
 
@@ -247,6 +286,26 @@ nlohmann::json cReport::convertWorker(const cWorker* worker)
 		json["static_counters"]["balancer_fragment_drops"] = worker->counters[(tCounterId)static_counter_type::balancer_fragment_drops];
 
 		json["static_counters"]["slow_worker_normal_priority_rate_limit_exceeded"] = worker->counters[(tCounterId)static_counter_type::slow_worker_normal_priority_rate_limit_exceeded];
+
+		json["static_counters"]["policer_local_class_drops"] = worker->counters[(tCounterId)static_counter_type::policer_local_class_drops];
+		json["static_counters"]["policer_local_source_drops"] = worker->counters[(tCounterId)static_counter_type::policer_local_source_drops];
+		json["static_counters"]["policer_kni_class_drops"] = worker->counters[(tCounterId)static_counter_type::policer_kni_class_drops];
+		json["static_counters"]["policer_kni_source_drops"] = worker->counters[(tCounterId)static_counter_type::policer_kni_source_drops];
+		json["static_counters"]["policer_slow_class_drops"] = worker->counters[(tCounterId)static_counter_type::policer_slow_class_drops];
+		json["static_counters"]["policer_slow_source_drops"] = worker->counters[(tCounterId)static_counter_type::policer_slow_source_drops];
+		json["static_counters"]["policer_evictions"] = worker->counters[(tCounterId)static_counter_type::policer_evictions];
+	}
+
+	/// top policed sources
+	for (const auto& top_source : worker->policer.top_sources(16))
+	{
+		nlohmann::json jsonSource;
+
+		jsonSource["class"] = common::policer::class_to_string(top_source.class_id);
+		jsonSource["prefix"] = common::ipv6_address_t(top_source.prefix.bytes).toString();
+		jsonSource["drops"] = top_source.drops;
+
+		json["policer"]["top_sources"].emplace_back(jsonSource);
 	}
 
 	return json;
@@ -583,11 +642,45 @@ static inline nlohmann::json convertFlow(const common::globalBase::tFlow& flow)
 
 nlohmann::json cReport::convertGlobalBase(const dataplane::globalBase::generation* globalBase)
 {
-	nlohmann::json json;
+	auto it = globalBaseTables.find(globalBase);
+	if (it == globalBaseTables.end())
+	{
+		it = globalBaseTables.emplace_hint(it, globalBase, convertGlobalBaseTables(globalBase));
+	}
+
+	nlohmann::json json = it->second;
 
 	json["pointer"] = pointerToHex(globalBase);
 	json["socketId"] = globalBase->socketId;
 
+	globalBase->updater.route_lpm4->report(json["route_lpm4"]);
+	globalBase->updater.route_lpm6->report(json["route_lpm6"]);
+	globalBase->updater.route_tunnel_lpm4->report(json["route_tunnel_lpm4"]);
+	globalBase->updater.route_tunnel_lpm6->report(json["route_tunnel_lpm6"]);
+
+	globalBase->updater.vrf_route_lpm4->report(json["vrf_route_lpm4"]);
+	globalBase->updater.vrf_route_lpm6->report(json["vrf_route_lpm6"]);
+	globalBase->updater.vrf_route_tunnel_lpm4->report(json["vrf_route_tunnel_lpm4"]);
+	globalBase->updater.vrf_route_tunnel_lpm6->report(json["vrf_route_tunnel_lpm6"]);
+
+	globalBase->updater.acl.network_table->report(json["acl"]["network_table"]);
+	globalBase->updater.acl.transport_table->report(json["acl"]["transport_table"]);
+	globalBase->updater.acl.total_table->report(json["acl"]["total_table"]);
+	globalBase->updater.acl.network_ipv4_source->report(json["acl"]["network"]["ipv4"]["source"]);
+	globalBase->updater.acl.network_ipv4_destination->report(json["acl"]["network"]["ipv4"]["destination"]);
+	globalBase->updater.acl.network_ipv6_source->report(json["acl"]["network"]["ipv6"]["source"]);
+	globalBase->updater.acl.network_ipv6_destination_ht->report(json["acl"]["network"]["ipv6"]["destination_ht"]);
+	globalBase->updater.acl.network_ipv6_destination->report(json["acl"]["network"]["ipv6"]["destination"]);
+
+	json["serial"] = globalBase->serial;
+
+	return json;
+}
+
+nlohmann::json cReport::convertGlobalBaseTables(const dataplane::globalBase::generation* globalBase)
+{
+	nlohmann::json json;
+
 	for (unsigned int logicalPortId = 0;
 	     logicalPortId < CONFIG_YADECAP_LOGICALPORTS_SIZE;
 	     logicalPortId++)
@@ -670,26 +763,5 @@ nlohmann::json cReport::convertGlobalBase(const dataplane::globalBase::generatio
 		json["interfaces"].emplace_back(jsonInterface);
 	}
 
-	globalBase->updater.route_lpm4->report(json["route_lpm4"]);
-	globalBase->updater.route_lpm6->report(json["route_lpm6"]);
-	globalBase->updater.route_tunnel_lpm4->report(json["route_tunnel_lpm4"]);
-	globalBase->updater.route_tunnel_lpm6->report(json["route_tunnel_lpm6"]);
-
-	globalBase->updater.vrf_route_lpm4->report(json["vrf_route_lpm4"]);
-	globalBase->updater.vrf_route_lpm6->report(json["vrf_route_lpm6"]);
-	globalBase->updater.vrf_route_tunnel_lpm4->report(json["vrf_route_tunnel_lpm4"]);
-	globalBase->updater.vrf_route_tunnel_lpm6->report(json["vrf_route_tunnel_lpm6"]);
-
-	globalBase->updater.acl.network_table->report(json["acl"]["network_table"]);
-	globalBase->updater.acl.transport_table->report(json["acl"]["transport_table"]);
-	globalBase->updater.acl.total_table->report(json["acl"]["total_table"]);
-	globalBase->updater.acl.network_ipv4_source->report(json["acl"]["network"]["ipv4"]["source"]);
-	globalBase->updater.acl.network_ipv4_destination->report(json["acl"]["network"]["ipv4"]["destination"]);
-	globalBase->updater.acl.network_ipv6_source->report(json["acl"]["network"]["ipv6"]["source"]);
-	globalBase->updater.acl.network_ipv6_destination_ht->report(json["acl"]["network"]["ipv6"]["destination_ht"]);
-	globalBase->updater.acl.network_ipv6_destination->report(json["acl"]["network"]["ipv6"]["destination"]);
-
-	json["serial"] = globalBase->serial;
-
 	return json;
 }
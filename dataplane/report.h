@@ -1,5 +1,7 @@
 #pragma once
 
+#include <map>
+
 #include <nlohmann/json.hpp>
 
 #include "type.h"
@@ -29,7 +31,13 @@ protected:
 	nlohmann::json convertBus(const cBus* bus);
 	nlohmann::json convertGlobalBaseAtomic(const dataplane::globalBase::atomic* globalBaseAtomic);
 	nlohmann::json convertGlobalBase(const dataplane::globalBase::generation* globalBase);
+	nlohmann::json convertGlobalBaseTables(const dataplane::globalBase::generation* globalBase);
 
 protected:
 	cDataPlane* dataPlane;
+
+	/// logicalPorts, tun64tunnels, decaps and interfaces of current globalbases.
+	/// Current generation is never updated in place, so tables are walked once per switchGlobalBase
+	uint32_t globalBaseTablesSerial;
+	std::map<const dataplane::globalBase::generation*, nlohmann::json> globalBaseTables;
 };
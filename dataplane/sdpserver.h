@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstring>
+
 #include <rte_byteorder.h>
 
 #include "common/result.h"
@@ -38,6 +40,9 @@ public:
 		}
 
 		// Create buffers in shared memory for workers in numa nodes
+		// Buffers are on regular pages and are not populated: most of counters are never allocated,
+		// their pages are never touched and are not backed by memory. Huge pages would be reserved
+		// for the whole buffer at creation.
 #ifndef YANET_USE_POSIX_SHARED_MEMORY
 		key_t key_shared_memory_segment = YANET_SHARED_MEMORY_KEY_DATAPLANE;
 #endif
@@ -46,7 +51,7 @@ public:
 		{
 #ifdef YANET_USE_POSIX_SHARED_MEMORY
 			std::string filename = common::sdp::FileNameWorkerOnNumaNode(socket_id);
-			void* buffer = common::ipc::SharedMemory::CreateBufferFile(filename, size, use_huge_tlb, socket_id);
+			void* buffer = common::ipc::SharedMemory::CreateBufferFile(filename, size, false, socket_id, false);
 			if (buffer == nullptr)
 			{
 				YANET_LOG_ERROR("Error create buffer in shared memory for workers on numa=%d, filename=%s, size=%ld\n",
@@ -57,7 +62,7 @@ public:
 			}
 #else
 			key_shared_memory_segment++;
-			void* buffer = common::ipc::SharedMemory::CreateBufferKey(key_shared_memory_segment, size, use_huge_tlb, socket_id);
+			void* buffer = common::ipc::SharedMemory::CreateBufferKey(key_shared_memory_segment, size, false, socket_id, false);
 			if (buffer == nullptr)
 			{
 				YANET_LOG_ERROR("Error create buffer in shared memory for workers on numa=%d, key=%d, size=%ld\n",
@@ -125,6 +130,31 @@ public:
 		return result;
 	}
 
+	/// Replaces neighbor table of the TABLES section. Callers must not write concurrently.
+	static void WriteNeighborTable(const DataPlaneInSharedMemory& sdp_data,
+	                               const std::vector<NeighborEntry>& entries,
+	                               uint64_t timestamp)
+	{
+		TablesHeader* header = sdp_data.Tables();
+		uint64_t count = std::min((uint64_t)entries.size(), header->neighbor_capacity);
+		if (count < entries.size())
+		{
+			YANET_LOG_WARNING("neighbor table in shared memory is truncated: %lu of %lu entries\n",
+			                  count,
+			                  entries.size());
+		}
+
+		uint64_t generation = header->generation.load(std::memory_order_relaxed);
+		header->generation.store(generation + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		std::memcpy(sdp_data.NeighborEntries(), entries.data(), count * sizeof(NeighborEntry));
+		header->neighbor_count = count;
+		header->timestamp = timestamp;
+
+		header->generation.store(generation + 2, std::memory_order_release);
+	}
+
 private:
 	static void WriteMainDataToBuffer(DataPlaneInSharedMemory& sdp_data)
 	{
@@ -141,6 +171,10 @@ private:
 		WriteValue(sdp_data, 4, sdp_data.start_bus_section);
 		WriteValue(sdp_data, 5, sdp_data.size_bus_section);
 
+		sdp_data.start_tables_section = sdp_data.start_bus_section + sdp_data.size_bus_section;
+		WriteValue(sdp_data, 6, sdp_data.start_tables_section);
+		WriteValue(sdp_data, 7, sdp_data.size_tables_section);
+
 		// WORKERS
 		{
 			uint64_t index = start_workers / sizeof(uint64_t);
@@ -185,6 +219,17 @@ private:
 			WriteMap(sdp_data, start_workers_metadata + 128, sdp_data.metadata_worker.counter_positions);
 			WriteMap(sdp_data, start_workers_metadata + 128 * (1 + sdp_data.metadata_worker.counter_positions.size()), sdp_data.metadata_worker_gc.counter_positions);
 		}
+
+		// TABLES
+		{
+			TablesHeader* header = sdp_data.Tables();
+			header->version = TablesHeader::layout_version;
+			header->entry_size = sizeof(NeighborEntry);
+			header->neighbor_capacity = sdp_data.neighbor_capacity;
+			header->generation.store(0, std::memory_order_relaxed);
+			header->neighbor_count = 0;
+			header->timestamp = 0;
+		}
 	}
 
 	static void WriteMap(DataPlaneInSharedMemory& sdp_data, uint64_t index, const std::map<std::string, uint64_t>& values)
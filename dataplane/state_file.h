@@ -0,0 +1,230 @@
+#pragma once
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "common/define.h"
+#include "common/result.h"
+
+#include "hashtable.h"
+
+/*
+
+File of dataplane states, written by `state export` and read by `state import`
+
+All values are stored in host byte order, the file is read on the same host.
+
+- file_header_t
+- tables_count tables, each table:
+  - table_header_t
+  - count pairs of key and value, sizeof(key_type) and sizeof(value_type) bytes
+
+A table is imported only if its name, key size and value size match the reading process,
+other tables are skipped. layout_version must be incremented on any change of key or
+value layout which keeps their sizes.
+
+Export and import keep established states over a restart, traffic is dropped while no
+dataplane process runs.
+
+*/
+
+namespace dataplane::state_file
+{
+
+constexpr uint64_t magic = 0x41545354454E4159; ///< "YANETSTA"
+constexpr uint32_t layout_version = 1;
+
+struct file_header_t
+{
+	uint64_t magic;
+	uint32_t version;
+	uint32_t tables_count;
+};
+
+struct table_header_t
+{
+	char name[64];
+	uint32_t key_size;
+	uint32_t value_size;
+	uint64_t count;
+};
+
+inline eResult write_header(FILE* file, const uint32_t tables_count)
+{
+	file_header_t header{magic, layout_version, tables_count};
+	if (fwrite(&header, sizeof(header), 1, file) != 1)
+	{
+		return eResult::errorOpenFile;
+	}
+
+	return eResult::success;
+}
+
+inline eResult read_header(FILE* file, file_header_t& header)
+{
+	if (fread(&header, sizeof(header), 1, file) != 1)
+	{
+		return eResult::errorOpenFile;
+	}
+
+	if (header.magic != magic ||
+	    header.version != layout_version)
+	{
+		YANET_LOG_ERROR("incompatible states file: magic: %lx, version: %u, expected version: %u\n",
+		                header.magic,
+		                header.version,
+		                layout_version);
+		return eResult::unsupported;
+	}
+
+	return eResult::success;
+}
+
+/// Writes valid pairs of all socket copies of a table.
+///
+/// Socket copies usually hold the same states, duplicates are skipped on import.
+template<typename hashtable_T>
+eResult write_table(FILE* file,
+                    const char* name,
+                    const std::vector<typename hashtable_T::updater*>& updaters)
+{
+	using key_type = typename hashtable_T::key_type;
+	using value_type = typename hashtable_T::value_type;
+
+	table_header_t header{};
+	snprintf(header.name, sizeof(header.name), "%s", name);
+	header.key_size = sizeof(key_type);
+	header.value_size = sizeof(value_type);
+
+	long header_position = ftell(file);
+	if (fwrite(&header, sizeof(header), 1, file) != 1)
+	{
+		return eResult::errorOpenFile;
+	}
+
+	for (auto* updater : updaters)
+	{
+		uint32_t offset = 0;
+		do
+		{
+			for (auto iter : updater->range(offset, 64 * 1024))
+			{
+				iter.lock();
+				if (!iter.is_valid())
+				{
+					iter.unlock();
+					continue;
+				}
+
+				key_type key = *iter.key();
+				value_type value = *iter.value();
+				iter.unlock();
+
+				if (fwrite(&key, sizeof(key), 1, file) != 1 ||
+				    fwrite(&value, sizeof(value), 1, file) != 1)
+				{
+					return eResult::errorOpenFile;
+				}
+
+				header.count++;
+			}
+		} while (offset != 0);
+	}
+
+	/// rewrite header with count
+	long end_position = ftell(file);
+	if (fseek(file, header_position, SEEK_SET) != 0 ||
+	    fwrite(&header, sizeof(header), 1, file) != 1 ||
+	    fseek(file, end_position, SEEK_SET) != 0)
+	{
+		return eResult::errorOpenFile;
+	}
+
+	YANET_LOG_INFO("state export: exported %lu pairs of '%s'\n", header.count, name);
+	return eResult::success;
+}
+
+inline eResult read_table_header(FILE* file, table_header_t& header)
+{
+	if (fread(&header, sizeof(header), 1, file) != 1)
+	{
+		return eResult::errorOpenFile;
+	}
+
+	header.name[sizeof(header.name) - 1] = 0;
+	return eResult::success;
+}
+
+inline eResult skip_table(FILE* file, const table_header_t& header)
+{
+	YANET_LOG_WARNING("state import: skip incompatible table '%s', key_size: %u, value_size: %u\n",
+	                  header.name,
+	                  header.key_size,
+	                  header.value_size);
+
+	if (fseek(file, (long)(header.count * (header.key_size + header.value_size)), SEEK_CUR) != 0)
+	{
+		return eResult::errorOpenFile;
+	}
+
+	return eResult::success;
+}
+
+/// Inserts pairs into all socket copies of a table, existing keys are kept.
+template<typename hashtable_T>
+eResult read_table(FILE* file,
+                   const table_header_t& header,
+                   const std::vector<hashtable_T*>& hashtables)
+{
+	using key_type = typename hashtable_T::key_type;
+	using value_type = typename hashtable_T::value_type;
+
+	if (header.key_size != sizeof(key_type) ||
+	    header.value_size != sizeof(value_type))
+	{
+		return skip_table(file, header);
+	}
+
+	uint64_t inserted = 0;
+	uint64_t failed = 0;
+	for (uint64_t pair_i = 0;
+	     pair_i < header.count;
+	     pair_i++)
+	{
+		key_type key;
+		value_type value;
+		if (fread(&key, sizeof(key), 1, file) != 1 ||
+		    fread(&value, sizeof(value), 1, file) != 1)
+		{
+			return eResult::errorOpenFile;
+		}
+
+		for (auto* hashtable : hashtables)
+		{
+			value_type* lookup_value = nullptr;
+			dataplane::spinlock_nonrecursive_t* locker = nullptr;
+			const uint32_t hash = hashtable->lookup(key, lookup_value, locker);
+			if (!lookup_value)
+			{
+				if (hashtable->insert(hash, key, value))
+				{
+					inserted++;
+				}
+				else
+				{
+					failed++;
+				}
+			}
+			locker->unlock();
+		}
+	}
+
+	YANET_LOG_INFO("state import: imported %lu pairs of '%s', failed: %lu\n",
+	               inserted,
+	               header.name,
+	               failed);
+	return eResult::success;
+}
+
+}
@@ -3,6 +3,7 @@
 #include <rte_ether.h>
 
 #include "common/balancer.h"
+#include "common/policer.h"
 #include "common/scheduler.h"
 #include "common/type.h"
 
@@ -366,6 +367,7 @@ struct nat46clat_t
 {
 	ipv6_address_t ipv6_source;
 	ipv6_address_t ipv6_destination;
+	uint16_t ipv6_prefixes_checksum; ///< checksum of first 96 bits of ipv6_source and ipv6_destination
 	tCounterId counter_id;
 	uint8_t ipv4_dscp_flags;
 	tVrfId vrf_lan;
@@ -539,6 +541,34 @@ struct nat64stateless_translation_t
 };
 
 static_assert(sizeof(nat64stateless_translation_t) % 8 == 0);
+
+struct nat64stateless_ingress_key_t
+{
+	ipv6_address_t ipv6Address;
+	uint8_t ipv6DestinationPrefix[12];
+	tNat64statelessId nat64stateless_id;
+
+	bool operator==(const nat64stateless_ingress_key_t& second) const
+	{
+		return !memcmp(this, &second, sizeof(*this));
+	}
+};
+
+static_assert(sizeof(nat64stateless_ingress_key_t) == 32, "nat64stateless_ingress_key_t has padding");
+
+struct nat64stateless_egress_key_t
+{
+	ipv4_address_t ipv4Address;
+	tNat64statelessId nat64stateless_id;
+
+	bool operator==(const nat64stateless_egress_key_t& second) const
+	{
+		return ipv4Address == second.ipv4Address &&
+		       nat64stateless_id == second.nat64stateless_id;
+	}
+};
+
+static_assert(sizeof(nat64stateless_egress_key_t) == 8, "nat64stateless_egress_key_t has padding");
 static_assert(YANET_CONFIG_COUNTERS_SIZE <= 0xFFFFFF, "invalid size");
 
 struct tun64mapping_key_t
@@ -836,6 +866,9 @@ struct host_config_t
 	ipv4_address_t ipv4_address{};
 	ipv6_address_t ipv6_address{};
 	bool show_real_address{};
+	common::policer::rate_t time_exceeded_rate{}; ///< per worker, per source prefix
+	uint8_t time_exceeded_ipv4_prefix{24};
+	uint8_t time_exceeded_ipv6_prefix{64};
 };
 }
 
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "../fw_state_page.h"
+
+namespace
+{
+
+using key_t = common::idp::getFWState::key_t;
+using value_t = common::idp::getFWState::value_t;
+
+key_t make_key(uint16_t src_port)
+{
+	return {IPPROTO_TCP, common::ip_address_t("10.0.0.1"), common::ip_address_t("10.0.0.2"), src_port, 80};
+}
+
+value_t make_value(uint8_t owner, uint64_t packets)
+{
+	return {owner, 0, 0, packets, packets};
+}
+
+class fw_states_t
+{
+public:
+	common::idp::get_fw_state_page::response page(const std::optional<key_t>& cursor, uint32_t limit) const
+	{
+		return dataplane::fw_state::page({{}, cursor, limit}, [&](const auto& callback) {
+			for (const auto& map : maps)
+			{
+				callback(map);
+			}
+		});
+	}
+
+	/// collects all pages, fails on a cursor which does not advance
+	common::idp::getFWState::response all(uint32_t limit) const
+	{
+		common::idp::getFWState::response result;
+		std::optional<key_t> cursor;
+		do
+		{
+			auto [states, next_cursor] = page(cursor, limit);
+			EXPECT_TRUE(!next_cursor || !cursor || *cursor < *next_cursor);
+			if (next_cursor && cursor && !(*cursor < *next_cursor))
+			{
+				break;
+			}
+
+			result.insert(states.begin(), states.end());
+			cursor = next_cursor;
+		} while (cursor);
+
+		return result;
+	}
+
+	std::vector<dataplane::fw_state::map_t> maps;
+};
+
+TEST(FWStatePage, Merge)
+{
+	fw_states_t fw_states;
+	fw_states.maps.resize(2);
+	fw_states.maps[0][make_key(1)] = make_value((uint8_t)common::fwstate::owner_e::external, 1);
+	fw_states.maps[1][make_key(1)] = make_value((uint8_t)common::fwstate::owner_e::internal, 2);
+	fw_states.maps[1][make_key(2)] = make_value((uint8_t)common::fwstate::owner_e::external, 3);
+
+	auto [states, next_cursor] = fw_states.page(std::nullopt, 16);
+	EXPECT_FALSE(next_cursor);
+	ASSERT_EQ(states.size(), 2u);
+	EXPECT_EQ(std::get<0>(states[make_key(1)]), (uint8_t)common::fwstate::owner_e::internal);
+	EXPECT_EQ(std::get<3>(states[make_key(1)]), 3u);
+	EXPECT_EQ(std::get<3>(states[make_key(2)]), 3u);
+}
+
+TEST(FWStatePage, Pages)
+{
+	fw_states_t fw_states;
+	fw_states.maps.resize(3);
+	for (uint16_t port = 0; port < 100; port++)
+	{
+		fw_states.maps[port % 3][make_key(port)] = make_value(0, 1);
+		fw_states.maps[(port + 1) % 3][make_key(port)] = make_value(0, 1);
+	}
+
+	for (uint32_t limit : {1u, 7u, 100u, 1000u})
+	{
+		auto states = fw_states.all(limit);
+		ASSERT_EQ(states.size(), 100u) << limit;
+		for (const auto& [key, value] : states)
+		{
+			EXPECT_EQ(std::get<3>(value), 2u) << limit;
+		}
+	}
+}
+
+TEST(FWStatePage, ZeroLimit)
+{
+	fw_states_t fw_states;
+	fw_states.maps.resize(1);
+	for (uint16_t port = 0; port < 10; port++)
+	{
+		fw_states.maps[0][make_key(port)] = make_value(0, 1);
+	}
+
+	auto [states, next_cursor] = fw_states.page(make_key(3), 0);
+	ASSERT_EQ(states.size(), 1u);
+	EXPECT_EQ(states.begin()->first, make_key(3));
+	ASSERT_TRUE(next_cursor);
+	EXPECT_EQ(*next_cursor, make_key(4));
+
+	EXPECT_EQ(fw_states.all(0).size(), 10u);
+}
+
+}
@@ -1,3 +1,5 @@
+#include <cstdlib>
+
 #include <gtest/gtest.h>
 
 #include "../hashtable.h"
@@ -474,4 +476,111 @@ TEST(hashtable_mod_spinlock, collision)
 	}
 }
 
+TEST(hashtable_cuckoo_id32, load)
+{
+	using ht_t = dataplane::hashtable_cuckoo_id32<ipv6_address_t>;
+
+	constexpr uint32_t buckets_size = 1024;
+	void* memory = std::aligned_alloc(RTE_CACHE_LINE_SIZE, RTE_ALIGN_CEIL(ht_t::calculate_sizeof(buckets_size), RTE_CACHE_LINE_SIZE));
+	auto* ht = new (memory) ht_t(buckets_size);
+
+	/// 95% load factor
+	const uint32_t keys_count = buckets_size * ht_t::bucket_size * 95 / 100;
+
+	std::vector<std::tuple<ipv6_address_t, uint32_t>> pairs;
+	for (uint32_t i = 0; i < keys_count; i++)
+	{
+		ipv6_address_t key{};
+		key.mapped_ipv4_address.address = i;
+		pairs.emplace_back(key, i);
+	}
+
+	ht_t::stats_t stats;
+	EXPECT_EQ(eResult::success, ht->fill(stats, pairs));
+	EXPECT_EQ(keys_count, stats.pairs_count);
+	EXPECT_EQ(0, stats.insert_failed);
+
+	uint32_t hashes[YANET_CONFIG_BURST_SIZE];
+	ipv6_address_t keys[YANET_CONFIG_BURST_SIZE];
+	uint32_t values[YANET_CONFIG_BURST_SIZE];
+
+	for (uint32_t i = 0; i < keys_count; i += YANET_CONFIG_BURST_SIZE)
+	{
+		const uint32_t count = std::min(keys_count - i, (uint32_t)YANET_CONFIG_BURST_SIZE);
+		for (uint32_t key_i = 0; key_i < count; key_i++)
+		{
+			keys[key_i] = std::get<0>(pairs[i + key_i]);
+		}
+
+		const uint32_t mask = ht->lookup(hashes, keys, values, count);
+		for (uint32_t key_i = 0; key_i < count; key_i++)
+		{
+			EXPECT_TRUE(mask & (1u << key_i));
+			EXPECT_EQ(i + key_i, values[key_i]);
+		}
+	}
+
+	/// missed keys
+	for (uint32_t key_i = 0; key_i < YANET_CONFIG_BURST_SIZE; key_i++)
+	{
+		keys[key_i] = {};
+		keys[key_i].mapped_ipv4_address.address = keys_count + key_i;
+	}
+	EXPECT_EQ(0, ht->lookup(hashes, keys, values, YANET_CONFIG_BURST_SIZE));
+
+	/// rewrite
+	EXPECT_EQ(eResult::success, ht->insert(stats, std::get<0>(pairs[0]), 0x31337));
+	EXPECT_EQ(1, stats.rewrites);
+	keys[0] = std::get<0>(pairs[0]);
+	EXPECT_EQ(1, ht->lookup(hashes, keys, values, 1));
+	EXPECT_EQ(0x31337, values[0]);
+
+	ht->~ht_t();
+	std::free(memory);
+}
+
+TEST(hashtable_cuckoo_id32, full)
+{
+	using ht_t = dataplane::hashtable_cuckoo_id32<uint32_t>;
+
+	constexpr uint32_t buckets_size = 16;
+	void* memory = std::aligned_alloc(RTE_CACHE_LINE_SIZE, RTE_ALIGN_CEIL(ht_t::calculate_sizeof(buckets_size), RTE_CACHE_LINE_SIZE));
+	auto* ht = new (memory) ht_t(buckets_size);
+
+	ht_t::stats_t stats{};
+	uint32_t inserted = 0;
+	for (uint32_t i = 0; i < 2 * buckets_size * ht_t::bucket_size; i++)
+	{
+		if (ht->insert(stats, i, i) == eResult::success)
+		{
+			inserted++;
+		}
+	}
+
+	EXPECT_LE(buckets_size * ht_t::bucket_size * 9 / 10, inserted);
+	EXPECT_GE(buckets_size * ht_t::bucket_size, inserted);
+	EXPECT_EQ(inserted, stats.pairs_count);
+
+	/// failed insertions do not lose keys
+	uint32_t hashes[YANET_CONFIG_BURST_SIZE];
+	uint32_t keys[YANET_CONFIG_BURST_SIZE];
+	uint32_t values[YANET_CONFIG_BURST_SIZE];
+
+	uint32_t found = 0;
+	for (uint32_t i = 0; i < 2 * buckets_size * ht_t::bucket_size; i++)
+	{
+		keys[0] = i;
+		if (ht->lookup(hashes, keys, values, 1))
+		{
+			EXPECT_EQ(i, values[0]);
+			found++;
+		}
+	}
+
+	EXPECT_EQ(inserted, found);
+
+	ht->~ht_t();
+	std::free(memory);
+}
+
 }
@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+
+#include "../idle.h"
+
+namespace
+{
+
+TEST(Idle, Disabled)
+{
+	dataplane::idle::backoff_t backoff;
+	backoff.init(0, 100);
+
+	EXPECT_FALSE(backoff.enabled());
+	for (unsigned int i = 0; i < 16; i++)
+	{
+		EXPECT_EQ(0u, backoff.idle());
+	}
+}
+
+TEST(Idle, Backoff)
+{
+	dataplane::idle::backoff_t backoff;
+	backoff.init(3, 10);
+
+	/// polls at full speed first
+	for (unsigned int i = 0; i < 3; i++)
+	{
+		EXPECT_EQ(0u, backoff.idle());
+	}
+
+	EXPECT_EQ(1u, backoff.idle());
+	EXPECT_EQ(2u, backoff.idle());
+	EXPECT_EQ(4u, backoff.idle());
+	EXPECT_EQ(8u, backoff.idle());
+	EXPECT_EQ(10u, backoff.idle());
+	EXPECT_EQ(10u, backoff.idle());
+
+	/// traffic resets backoff
+	backoff.busy();
+	EXPECT_EQ(0u, backoff.idle());
+}
+
+}
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <memory>
+
+#include "../policer.h"
+
+namespace
+{
+
+constexpr uint64_t hz = 1000000;
+
+dataplane::policer::config_t make_config()
+{
+	dataplane::policer::config_t config;
+	config.table_size = 16;
+	config.ipv4_prefix = 24;
+	config.classes[(uint8_t)dataplane::policer::class_e::local].source = {1000, 10};
+	config.classes[(uint8_t)dataplane::policer::class_e::kni].aggregate = {1000, 5};
+	return config;
+}
+
+uint32_t ipv4(const char* string)
+{
+	uint32_t address;
+	inet_pton(AF_INET, string, &address);
+	return address;
+}
+
+TEST(Policer, Bucket)
+{
+	dataplane::policer::bucket_t bucket;
+	bucket.init({1000, 4}, hz, 0);
+
+	for (unsigned int i = 0; i < 4; i++)
+	{
+		EXPECT_TRUE(bucket.consume(0));
+	}
+	EXPECT_FALSE(bucket.consume(0));
+
+	/// 1000 pps at 1MHz: one token per 1000 cycles
+	EXPECT_FALSE(bucket.consume(999));
+	EXPECT_TRUE(bucket.consume(1000));
+	EXPECT_FALSE(bucket.consume(1000));
+
+	/// refill never exceeds burst
+	for (unsigned int i = 0; i < 4; i++)
+	{
+		EXPECT_TRUE(bucket.consume(1000000));
+	}
+	EXPECT_FALSE(bucket.consume(1000000));
+
+	dataplane::policer::bucket_t unlimited;
+	unlimited.init({0, 0}, hz, 0);
+	EXPECT_TRUE(unlimited.consume(0));
+}
+
+TEST(Policer, Sources)
+{
+	auto config = make_config();
+	std::vector<dataplane::policer::source_bucket_t> buckets(dataplane::policer::policer_t::calculate_buckets_size(config.table_size));
+
+	dataplane::policer::policer_t policer;
+	policer.init(config, buckets.data(), buckets.size(), hz, 0);
+
+	using result_e = dataplane::policer::policer_t::result_e;
+	const auto class_id = dataplane::policer::class_e::local;
+
+	/// same /24: shared bucket
+	for (unsigned int i = 0; i < 10; i++)
+	{
+		EXPECT_EQ(result_e::pass, policer.check(class_id, policer.source_ipv4(ipv4(i % 2 ? "10.0.0.1" : "10.0.0.2")), 0));
+	}
+	EXPECT_EQ(result_e::source_drop, policer.check(class_id, policer.source_ipv4(ipv4("10.0.0.3")), 0));
+
+	/// other source is not affected
+	EXPECT_EQ(result_e::pass, policer.check(class_id, policer.source_ipv4(ipv4("10.0.1.1")), 0));
+
+	/// other class has no source limit
+	EXPECT_EQ(result_e::pass, policer.check(dataplane::policer::class_e::slow, policer.source_ipv4(ipv4("10.0.0.3")), 0));
+
+	auto top_sources = policer.top_sources(4);
+	ASSERT_EQ(1u, top_sources.size());
+	EXPECT_EQ(1u, top_sources[0].drops);
+	EXPECT_EQ(ipv4("10.0.0.0"), top_sources[0].prefix.mapped_ipv4_address.address);
+}
+
+TEST(Policer, TopSources)
+{
+	auto config = make_config();
+	config.table_size = 1024;
+	std::vector<dataplane::policer::source_bucket_t> buckets(dataplane::policer::policer_t::calculate_buckets_size(config.table_size));
+
+	dataplane::policer::policer_t policer;
+	policer.init(config, buckets.data(), buckets.size(), hz, 0);
+
+	/// source i drops i packets over burst
+	for (uint32_t i = 0; i < 8; i++)
+	{
+		for (uint32_t packet_i = 0; packet_i < 10 + i; packet_i++)
+		{
+			policer.check(dataplane::policer::class_e::local, policer.source_ipv4(ipv4("10.0.0.0") + (i << 8)), 0);
+		}
+	}
+
+	auto top_sources = policer.top_sources(3);
+	ASSERT_EQ(3u, top_sources.size());
+	for (uint32_t i = 0; i < 3; i++)
+	{
+		EXPECT_EQ(7u - i, top_sources[i].drops);
+	}
+
+	EXPECT_EQ(7u, policer.top_sources(16).size());
+}
+
+TEST(Policer, Aggregate)
+{
+	auto config = make_config();
+	std::vector<dataplane::policer::source_bucket_t> buckets(dataplane::policer::policer_t::calculate_buckets_size(config.table_size));
+
+	dataplane::policer::policer_t policer;
+	policer.init(config, buckets.data(), buckets.size(), hz, 0);
+
+	using result_e = dataplane::policer::policer_t::result_e;
+	const auto class_id = dataplane::policer::class_e::kni;
+
+	for (uint32_t i = 0; i < 5; i++)
+	{
+		EXPECT_EQ(result_e::pass, policer.check(class_id, policer.source_ipv4(i), 0));
+	}
+	EXPECT_EQ(result_e::class_drop, policer.check(class_id, policer.source_ipv4(5), 0));
+	EXPECT_EQ(result_e::pass, policer.check(class_id, policer.source_ipv4(5), 1000));
+}
+
+TEST(Policer, Eviction)
+{
+	auto config = make_config();
+	config.table_size = 4;
+	std::vector<dataplane::policer::source_bucket_t> buckets(dataplane::policer::policer_t::calculate_buckets_size(config.table_size));
+
+	dataplane::policer::policer_t policer;
+	policer.init(config, buckets.data(), buckets.size(), hz, 0);
+
+	for (uint32_t i = 0; i < 8; i++)
+	{
+		policer.check(dataplane::policer::class_e::local, policer.source_ipv4(ipv4("10.0.0.0") + (i << 8)), i);
+	}
+
+	EXPECT_EQ(4u, policer.get_evictions());
+}
+
+TEST(Policer, IcmpLimiter)
+{
+	auto limiter = std::make_unique<dataplane::policer::icmp_limiter_t>();
+	const dataplane::policer::rate_t rate{1000, 2};
+
+	/// same /24: shared meter
+	EXPECT_TRUE(limiter->consume_ipv4(rate, 24, ipv4("10.0.0.1"), hz, 0));
+	EXPECT_TRUE(limiter->consume_ipv4(rate, 24, ipv4("10.0.0.2"), hz, 0));
+	EXPECT_FALSE(limiter->consume_ipv4(rate, 24, ipv4("10.0.0.3"), hz, 0));
+	EXPECT_TRUE(limiter->consume_ipv4(rate, 24, ipv4("10.0.0.3"), hz, 1000));
+
+	/// other source is not affected
+	EXPECT_TRUE(limiter->consume_ipv4(rate, 24, ipv4("10.0.1.1"), hz, 0));
+
+	/// zero rate is unlimited
+	for (unsigned int i = 0; i < 4; i++)
+	{
+		EXPECT_TRUE(limiter->consume_ipv4({0, 0}, 24, ipv4("10.0.0.1"), hz, 0));
+	}
+}
+
+} // namespace
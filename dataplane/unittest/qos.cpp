@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <vector>
+
+#include "../qos.h"
+
+namespace
+{
+
+constexpr uint64_t hz = 1000000;
+
+class packets_t
+{
+public:
+	rte_mbuf* make(const uint8_t dscp, const uint32_t size = 100)
+	{
+		auto& data = datas.emplace_back(128, 0);
+		auto* ethernetHeader = reinterpret_cast<rte_ether_hdr*>(data.data());
+		ethernetHeader->ether_type = rte_cpu_to_be_16(RTE_ETHER_TYPE_IPV4);
+		auto* ipv4Header = reinterpret_cast<rte_ipv4_hdr*>(data.data() + sizeof(rte_ether_hdr));
+		ipv4Header->type_of_service = dscp << 2;
+
+		auto& mbuf = mbufs.emplace_back();
+		mbuf.buf_addr = data.data();
+		mbuf.data_off = 0;
+		mbuf.pkt_len = size;
+		return &mbuf;
+	}
+
+protected:
+	std::deque<std::vector<uint8_t>> datas;
+	std::deque<rte_mbuf> mbufs;
+};
+
+dataplane::qos::port_config_t make_config()
+{
+	dataplane::qos::port_config_t config;
+	config.classes_count = 3;
+	config.dscp_to_class[46] = 0;
+	config.dscp_to_class[10] = 1;
+	config.dscp_to_class[12] = 2;
+	config.classes[0] = {0, 1, 4};
+	config.classes[1] = {1, 3, 16};
+	config.classes[2] = {1, 1, 16};
+	return config;
+}
+
+uint8_t get_dscp(rte_mbuf* mbuf)
+{
+	return dataplane::qos::scheduler_t::get_dscp(mbuf);
+}
+
+TEST(Qos, Priority)
+{
+	auto config = make_config();
+	std::vector<rte_mbuf*> storage(dataplane::qos::scheduler_t::calculate_storage_size(config));
+
+	dataplane::qos::scheduler_t scheduler;
+	scheduler.init(config, storage.data(), hz, 0);
+
+	packets_t packets;
+	for (unsigned int i = 0; i < 4; i++)
+	{
+		EXPECT_TRUE(scheduler.enqueue(packets.make(10)));
+		EXPECT_TRUE(scheduler.enqueue(packets.make(46)));
+	}
+
+	/// priority queue is full
+	EXPECT_FALSE(scheduler.enqueue(packets.make(46)));
+	EXPECT_EQ(1u, scheduler.get_stats(0).drops);
+
+	rte_mbuf* mbufs[8];
+	ASSERT_EQ(8, scheduler.dequeue(mbufs, 8, 0));
+	for (unsigned int i = 0; i < 4; i++)
+	{
+		EXPECT_EQ(46, get_dscp(mbufs[i]));
+	}
+	for (unsigned int i = 4; i < 8; i++)
+	{
+		EXPECT_EQ(10, get_dscp(mbufs[i]));
+	}
+	EXPECT_TRUE(scheduler.empty());
+}
+
+TEST(Qos, WeightedRoundRobin)
+{
+	auto config = make_config();
+	std::vector<rte_mbuf*> storage(dataplane::qos::scheduler_t::calculate_storage_size(config));
+
+	dataplane::qos::scheduler_t scheduler;
+	scheduler.init(config, storage.data(), hz, 0);
+
+	packets_t packets;
+	for (unsigned int i = 0; i < 8; i++)
+	{
+		scheduler.enqueue(packets.make(10));
+		scheduler.enqueue(packets.make(12));
+	}
+
+	rte_mbuf* mbufs[8];
+	ASSERT_EQ(8, scheduler.dequeue(mbufs, 8, 0));
+
+	unsigned int weighted = 0;
+	for (auto* mbuf : mbufs)
+	{
+		weighted += get_dscp(mbuf) == 10;
+	}
+	EXPECT_EQ(6u, weighted);
+}
+
+TEST(Qos, Shaper)
+{
+	auto config = make_config();
+	config.classes[1].queue_size = 32;
+	config.rate = 10000; ///< bytes per second
+	config.burst = 1000; ///< rounded up to max ethernet frame
+	std::vector<rte_mbuf*> storage(dataplane::qos::scheduler_t::calculate_storage_size(config));
+
+	dataplane::qos::scheduler_t scheduler;
+	scheduler.init(config, storage.data(), hz, 0);
+
+	packets_t packets;
+	for (unsigned int i = 0; i < 20; i++)
+	{
+		scheduler.enqueue(packets.make(10));
+	}
+
+	rte_mbuf* mbufs[32];
+
+	/// 1518 bytes of credits: packets are sent while credits are positive
+	EXPECT_EQ(16, scheduler.dequeue(mbufs, 32, 0));
+	EXPECT_EQ(0, scheduler.dequeue(mbufs, 32, 0));
+	EXPECT_EQ(4u, scheduler.get_queue_size(1));
+
+	/// 10ms: 100 bytes
+	EXPECT_EQ(1, scheduler.dequeue(mbufs, 32, 10000));
+	EXPECT_EQ(3u, scheduler.get_queue_size(1));
+}
+
+} // namespace
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <sys/mman.h>
+#include <unistd.h>
+
 #include "../../common/idp.h"
 #include "../../common/sdpclient.h"
 #include "../sdpserver.h"
@@ -114,6 +117,7 @@ public:
 		counters_stats["logs_packets"] = offsetof(common::worker::stats::common, logs_packets);
 		counters_stats["logs_drops"] = offsetof(common::worker::stats::common, logs_drops);
 		counters_stats["ttl_exceeded"] = offsetof(common::worker::stats::common, ttl_exceeded);
+		counters_stats["ttl_exceeded_limited"] = offsetof(common::worker::stats::common, ttl_exceeded_limited);
 		for (const auto& iter : counters_stats)
 		{
 			metadata.counter_positions[iter.first] = (metadata.start_stats + iter.second) / sizeof(uint64_t);
@@ -315,6 +319,46 @@ protected:
 	common::worker_gc::stats_t* stats;
 };
 
+/// Number of pages of [buffer, buffer + size) backed by memory
+static size_t ResidentPages(const void* buffer, size_t size)
+{
+	const uintptr_t page_size = sysconf(_SC_PAGESIZE);
+	const uintptr_t begin = (uintptr_t)buffer & ~(page_size - 1);
+	const uintptr_t end = ((uintptr_t)buffer + size + page_size - 1) & ~(page_size - 1);
+
+	std::vector<unsigned char> pages((end - begin) / page_size);
+	if (mincore((void*)begin, end - begin, pages.data()) != 0)
+	{
+		ADD_FAILURE() << "mincore: " << strerror(errno);
+		return 0;
+	}
+
+	return std::count_if(pages.begin(), pages.end(), [](const unsigned char page) { return page & 1; });
+}
+
+TEST(SDP, WorkerBuffersDemandPaged)
+{
+	/// hugeMem is on by default, worker buffers are on regular pages anyway
+	bool useHugeMem = true;
+	std::vector<tCoreId> workers_id = {1};
+	std::vector<tCoreId> workers_gc_id = {0};
+
+	common::sdp::DataPlaneInSharedMemory sdp_data_server;
+	TestWorker::FillMetadataWorkerCounters(sdp_data_server.metadata_worker);
+	TestWorkerGc::FillMetadataWorkerCounters(sdp_data_server.metadata_worker_gc);
+	sdp_data_server.size_bus_section = TestBus::GetSizeForCounters();
+	ASSERT_EQ(common::sdp::SdrSever::PrepareSharedMemoryData(sdp_data_server, workers_id, workers_gc_id, useHugeMem), eResult::success);
+
+	auto* counters = utils::ShiftBuffer<uint64_t*>(sdp_data_server.workers[1].buffer, sdp_data_server.metadata_worker.start_counters);
+	const size_t counters_size = YANET_CONFIG_COUNTERS_SIZE * sizeof(uint64_t);
+	EXPECT_EQ(0u, ResidentPages(counters, counters_size));
+
+	/// only pages of written counters are backed
+	counters[0] = 1;
+	counters[YANET_CONFIG_COUNTERS_SIZE / 2] = 1;
+	EXPECT_EQ(2u, ResidentPages(counters, counters_size));
+}
+
 TEST(SDP, FullTests)
 {
 	bool useHugeMem = false;
@@ -367,3 +411,61 @@ TEST(SDP, FullTests)
 		workers[coreId]->CompareWithClient(coreId, sdp_data_client);
 	}
 }
+
+TEST(SDP, NeighborTable)
+{
+	std::vector<tCoreId> workers_id = {1};
+	std::vector<tCoreId> workers_gc_id = {0};
+
+	common::sdp::DataPlaneInSharedMemory sdp_data_server;
+	TestWorker::FillMetadataWorkerCounters(sdp_data_server.metadata_worker);
+	TestWorkerGc::FillMetadataWorkerCounters(sdp_data_server.metadata_worker_gc);
+	sdp_data_server.size_bus_section = TestBus::GetSizeForCounters();
+	sdp_data_server.neighbor_capacity = 2;
+	ASSERT_EQ(common::sdp::SdrSever::PrepareSharedMemoryData(sdp_data_server, workers_id, workers_gc_id, false), eResult::success);
+
+	common::sdp::DataPlaneInSharedMemory sdp_data_client;
+	ASSERT_EQ(common::sdp::SdpClient::ReadSharedMemoryData(sdp_data_client, false), eResult::success);
+	ASSERT_EQ(sdp_data_server, sdp_data_client);
+
+	common::idp::neighbor_show::response response;
+	ASSERT_EQ(common::sdp::SdpClient::GetNeighborTable(sdp_data_client, response), eResult::success);
+	ASSERT_TRUE(response.empty());
+
+	std::vector<common::sdp::NeighborEntry> entries(3);
+	memset(entries.data(), 0, entries.size() * sizeof(common::sdp::NeighborEntry));
+	for (auto& entry : entries)
+	{
+		snprintf(entry.route_name, sizeof(entry.route_name), "route0");
+		snprintf(entry.interface_name, sizeof(entry.interface_name), "kni0.100");
+	}
+	entries[0].address[12] = 10;
+	entries[0].address[15] = 1;
+	entries[0].mac_address[5] = 1;
+	entries[0].last_update_timestamp = 90;
+	entries[1].address[0] = 0x20;
+	entries[1].address[15] = 2;
+	entries[1].mac_address[5] = 2;
+	entries[1].flags = common::sdp::NeighborEntry::flag_is_ipv6 | common::sdp::NeighborEntry::flag_is_static;
+
+	/// capacity is 2, last entry is truncated
+	common::sdp::SdrSever::WriteNeighborTable(sdp_data_server, entries, 100);
+	ASSERT_EQ(2u, sdp_data_client.Tables()->generation.load());
+
+	ASSERT_EQ(common::sdp::SdpClient::GetNeighborTable(sdp_data_client, response), eResult::success);
+	ASSERT_EQ(2u, response.size());
+
+	const auto& [route_name, interface_name, ip_address, mac_address, last_update] = response[0];
+	EXPECT_EQ("route0", route_name);
+	EXPECT_EQ("kni0.100", interface_name);
+	EXPECT_EQ(common::ip_address_t("10.0.0.1"), ip_address);
+	EXPECT_EQ(common::mac_address_t("00:00:00:00:00:01"), mac_address);
+	EXPECT_EQ(10u, last_update);
+
+	EXPECT_EQ(common::ip_address_t("2000::2"), std::get<2>(response[1]));
+	EXPECT_FALSE(std::get<4>(response[1]).has_value());
+
+	/// unknown layout is rejected
+	sdp_data_server.Tables()->version++;
+	EXPECT_EQ(common::sdp::SdpClient::GetNeighborTable(sdp_data_client, response), eResult::errorInitSharedMemory);
+}
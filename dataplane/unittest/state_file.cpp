@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <memory>
+
+#include "../state_file.h"
+
+namespace
+{
+
+struct test_key_t
+{
+	uint32_t address;
+	uint16_t port;
+	uint16_t proto;
+};
+
+struct test_value_t
+{
+	uint32_t last_seen;
+	uint32_t packets;
+};
+
+using hashtable_t = dataplane::hashtable_mod_spinlock_dynamic<test_key_t, test_value_t, 16>;
+using other_hashtable_t = dataplane::hashtable_mod_spinlock_dynamic<test_key_t, uint32_t, 16>;
+
+constexpr uint32_t total_size = 1024;
+
+template<typename hashtable_T>
+class table_t
+{
+public:
+	table_t() :
+	        memory(std::aligned_alloc(64, hashtable_T::calculate_sizeof(total_size)), std::free)
+	{
+		memset(memory.get(), 0, hashtable_T::calculate_sizeof(total_size));
+		hashtable = new (memory.get()) hashtable_T();
+		updater.update_pointer(hashtable, 0, total_size);
+	}
+
+	void insert(const test_key_t& key, const typename hashtable_T::value_type& value)
+	{
+		typename hashtable_T::value_type* lookup_value = nullptr;
+		dataplane::spinlock_nonrecursive_t* locker = nullptr;
+		const uint32_t hash = hashtable->lookup(key, lookup_value, locker);
+		EXPECT_EQ(nullptr, lookup_value);
+		EXPECT_TRUE(hashtable->insert(hash, key, value));
+		locker->unlock();
+	}
+
+	const typename hashtable_T::value_type* lookup(const test_key_t& key)
+	{
+		typename hashtable_T::value_type* lookup_value = nullptr;
+		dataplane::spinlock_nonrecursive_t* locker = nullptr;
+		hashtable->lookup(key, lookup_value, locker);
+		locker->unlock();
+		return lookup_value;
+	}
+
+	std::unique_ptr<void, decltype(&std::free)> memory;
+	hashtable_T* hashtable;
+	typename hashtable_T::updater updater;
+};
+
+TEST(StateFile, ExportImport)
+{
+	table_t<hashtable_t> source;
+	for (uint32_t i = 0; i < 100; i++)
+	{
+		source.insert({i, 80, 6}, {1000 + i, i});
+	}
+
+	table_t<hashtable_t> destination;
+	destination.insert({7, 80, 6}, {1, 1}); ///< existing key is kept
+
+	FILE* file = tmpfile();
+	ASSERT_NE(nullptr, file);
+
+	ASSERT_EQ(eResult::success, dataplane::state_file::write_header(file, 2));
+	ASSERT_EQ(eResult::success, dataplane::state_file::write_table<hashtable_t>(file, "state", {&source.updater}));
+	ASSERT_EQ(eResult::success, dataplane::state_file::write_table<hashtable_t>(file, "incompatible", {&source.updater}));
+
+	rewind(file);
+
+	table_t<other_hashtable_t> other;
+
+	dataplane::state_file::file_header_t file_header;
+	ASSERT_EQ(eResult::success, dataplane::state_file::read_header(file, file_header));
+	ASSERT_EQ(2u, file_header.tables_count);
+
+	dataplane::state_file::table_header_t header;
+	ASSERT_EQ(eResult::success, dataplane::state_file::read_table_header(file, header));
+	EXPECT_STREQ("state", header.name);
+	EXPECT_EQ(100u, header.count);
+	ASSERT_EQ(eResult::success, dataplane::state_file::read_table<hashtable_t>(file, header, {destination.hashtable}));
+
+	/// value size differs: table is skipped
+	ASSERT_EQ(eResult::success, dataplane::state_file::read_table_header(file, header));
+	ASSERT_EQ(eResult::success, dataplane::state_file::read_table<other_hashtable_t>(file, header, {other.hashtable}));
+	EXPECT_EQ(nullptr, other.lookup({1, 80, 6}));
+	EXPECT_EQ(EOF, fgetc(file));
+
+	for (uint32_t i = 0; i < 100; i++)
+	{
+		const auto* value = destination.lookup({i, 80, 6});
+		ASSERT_NE(nullptr, value);
+		EXPECT_EQ(i == 7 ? 1 : 1000 + i, value->last_seen);
+	}
+
+	fclose(file);
+}
+
+TEST(StateFile, IncompatibleVersion)
+{
+	FILE* file = tmpfile();
+	ASSERT_NE(nullptr, file);
+
+	dataplane::state_file::file_header_t file_header{dataplane::state_file::magic,
+	                                                     dataplane::state_file::layout_version + 1,
+	                                                     0};
+	fwrite(&file_header, sizeof(file_header), 1, file);
+	rewind(file);
+
+	EXPECT_EQ(eResult::unsupported, dataplane::state_file::read_header(file, file_header));
+
+	fclose(file);
+}
+
+}
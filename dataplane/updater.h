@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+
 #include <nlohmann/json.hpp>
 #include <rte_malloc.h>
 
@@ -570,6 +572,108 @@ public:
 
 //
 
+template<typename key_t,
+         hash_function_t<key_t> calculate_hash = calculate_hash_crc<key_t>>
+class updater_hashtable_cuckoo_id32
+{
+public:
+	using object_type = hashtable_cuckoo_id32<key_t, calculate_hash>;
+
+	updater_hashtable_cuckoo_id32(const char* name,
+	                              dataplane::memory_manager* memory_manager,
+	                              const tSocketId socket_id) :
+	        name(name),
+	        memory_manager(memory_manager),
+	        socket_id(socket_id),
+	        pointer(nullptr)
+	{
+	}
+
+	eResult init()
+	{
+		return update({});
+	}
+
+	eResult update(const std::vector<std::tuple<key_t, uint32_t>>& values, bool retry = true)
+	{
+		// sized for 80% load factor, insertion holds above 90%
+		uint32_t buckets_size = upper_power_of_two(std::max(object_type::buckets_size_min,
+		                                                    (uint32_t)((5ull * values.size() / 4 + object_type::bucket_size - 1) / object_type::bucket_size)));
+
+		clear();
+
+		eResult result = eResult::success;
+		for (;;)
+		{
+			pointer = memory_manager->create<object_type>(name.data(),
+			                                              socket_id,
+			                                              object_type::calculate_sizeof(buckets_size),
+			                                              buckets_size);
+			if (pointer == nullptr)
+			{
+				return eResult::errorAllocatingMemory;
+			}
+
+			result = pointer->fill(stats, values);
+			if (result == eResult::success || !retry)
+			{
+				break;
+			}
+
+			clear();
+			buckets_size *= 2;
+		}
+
+		return result;
+	}
+
+	void clear()
+	{
+		if (pointer)
+		{
+			memory_manager->destroy(pointer);
+			pointer = nullptr;
+		}
+	}
+
+	void limits(common::idp::limits::response& limits) const
+	{
+		limits.emplace_back(name + ".keys",
+		                    socket_id,
+		                    stats.pairs_count,
+		                    stats.pairs_size);
+	}
+
+	void report(nlohmann::json& report) const
+	{
+		report["pointer"] = to_hex(pointer);
+		report["pairs_count"] = stats.pairs_count;
+		report["pairs_size"] = stats.pairs_size;
+		report["insert_failed"] = stats.insert_failed;
+		report["rewrites"] = stats.rewrites;
+		report["moves"] = stats.moves;
+		report["longest_path"] = stats.longest_path;
+		if (pointer)
+		{
+			const uint64_t memory_size = object_type::calculate_sizeof(pointer->buckets_size());
+			report["memory_size"] = memory_size;
+			report["memory_per_pair"] = stats.pairs_count ? (double)memory_size / stats.pairs_count : 0.0;
+		}
+	}
+
+protected:
+	std::string name;
+	dataplane::memory_manager* memory_manager;
+	tSocketId socket_id;
+
+	typename object_type::stats_t stats{};
+
+public:
+	object_type* pointer;
+};
+
+//
+
 template<typename value_t>
 class updater_dynamic_table
 {
@@ -712,6 +816,39 @@ public:
 		return eResult::success;
 	}
 
+	/// Reallocates array if it holds less than count objects, keeping existing objects.
+	eResult grow(const uint64_t count)
+	{
+		if (pointer && count <= this->count)
+		{
+			return eResult::success;
+		}
+
+		object_type* next_pointer = memory_manager->create_static_array<object_type>(name.data(),
+		                                                                             count,
+		                                                                             socket_id);
+		if (next_pointer == nullptr)
+		{
+			return eResult::errorAllocatingMemory;
+		}
+
+		if (pointer)
+		{
+			std::copy(pointer, pointer + this->count, next_pointer);
+			memory_manager->destroy(pointer);
+		}
+
+		pointer = next_pointer;
+		this->count = count;
+
+		return eResult::success;
+	}
+
+	[[nodiscard]] uint64_t size() const
+	{
+		return count;
+	}
+
 	void clear()
 	{
 		if (pointer)
@@ -1,5 +1,6 @@
 #include <netinet/icmp6.h>
 #include <netinet/ip_icmp.h>
+#include <sys/prctl.h>
 
 #include <optional>
 #include <string>
@@ -40,6 +41,8 @@ cWorker::cWorker(cDataPlane* dataPlane) :
         coreId(-1),
         socketId(-1),
         mempool(nullptr),
+        mempool_small(nullptr),
+        mbuf_small_size(0),
         iteration(0),
         currentBaseId(0),
         localBaseId(0),
@@ -61,6 +64,11 @@ cWorker::~cWorker()
 		rte_mempool_free(mempool);
 	}
 
+	if (mempool_small)
+	{
+		rte_mempool_free(mempool_small);
+	}
+
 	if (ring_highPriority)
 	{
 		rte_ring_free(ring_highPriority);
@@ -111,10 +119,38 @@ eResult cWorker::init(const tCoreId& coreId,
 	this->bases[currentBaseId] = base;
 	this->bases[currentBaseId ^ 1] = base;
 
+	const auto& config = dataPlane->getConfigValues();
 	unsigned int elements_count = MempoolSize();
 
 	YADECAP_LOG_DEBUG("elements_count: %u\n", elements_count);
 
+	/// init small mempool, most of packets fit into it
+	if (config.worker_mbuf_small_size)
+	{
+		mbuf_small_size = config.worker_mbuf_small_size;
+		mempool_small = rte_mempool_create(("fps" + std::to_string(coreId)).data(),
+		                                   elements_count,
+		                                   sizeof(rte_mbuf) + RTE_PKTMBUF_HEADROOM + mbuf_small_size,
+		                                   0,
+		                                   sizeof(struct rte_pktmbuf_pool_private),
+		                                   rte_pktmbuf_pool_init,
+		                                   nullptr,
+		                                   rte_pktmbuf_init,
+		                                   nullptr,
+		                                   socketId,
+		                                   MEMPOOL_F_SP_PUT | MEMPOOL_F_SC_GET);
+		if (!mempool_small)
+		{
+			YADECAP_LOG_ERROR("rte_mempool_create(): %s [%u]\n", rte_strerror(rte_errno), rte_errno);
+			return eResult::errorInitMempool;
+		}
+
+		if (config.worker_mbuf_jumbo_count)
+		{
+			elements_count = config.worker_mbuf_jumbo_count;
+		}
+	}
+
 	/// init mempool
 	mempool = rte_mempool_create(("fp" + std::to_string(coreId)).data(),
 	                             elements_count,
@@ -198,6 +234,46 @@ eResult cWorker::init(const tCoreId& coreId,
 	balancer_state_config.tcp_fin_timeout = dataPlane->getConfigValues().balancer_tcp_fin_timeout;
 	balancer_state_config.udp_timeout = dataPlane->getConfigValues().balancer_udp_timeout;
 	balancer_state_config.default_timeout = dataPlane->getConfigValues().balancer_other_protocols_timeout;
+
+	if (basePermanently.policer.enabled())
+	{
+		uint32_t buckets_size = dataplane::policer::policer_t::calculate_buckets_size(basePermanently.policer.table_size);
+
+		auto* buckets = dataPlane->memory_manager.create_static_array<dataplane::policer::source_bucket_t>("worker.policer",
+		                                                                                                   buckets_size,
+		                                                                                                   socketId);
+		if (!buckets)
+		{
+			return eResult::errorAllocatingMemory;
+		}
+
+		policer.init(basePermanently.policer, buckets, buckets_size, rte_get_tsc_hz(), rte_get_tsc_cycles());
+	}
+
+	for (uint32_t port_i = 0;
+	     port_i < basePermanently.ports.size();
+	     port_i++)
+	{
+		const auto& qos_config = basePermanently.qos[port_i];
+		if (!qos_config.enabled())
+		{
+			continue;
+		}
+
+		auto* storage = dataPlane->memory_manager.create_static_array<rte_mbuf*>("worker.qos",
+		                                                                         dataplane::qos::scheduler_t::calculate_storage_size(qos_config),
+		                                                                         socketId);
+		if (!storage)
+		{
+			return eResult::errorAllocatingMemory;
+		}
+
+		qos_schedulers[port_i].init(qos_config, storage, rte_get_tsc_hz(), rte_get_tsc_cycles());
+		qos_enabled = true;
+	}
+
+	idle_backoff.init(basePermanently.idle_polls, basePermanently.idle_sleep_max_us);
+
 	return eResult::success;
 }
 
@@ -211,40 +287,48 @@ void cWorker::start()
 
 	/// @todo: prepare()
 
-	unsigned int mbufs_count = rte_mempool_avail_count(mempool);
+	for (rte_mempool* pool : {mempool_small, mempool})
+	{
+		if (!pool)
+		{
+			continue;
+		}
 
-	std::vector<rte_mbuf*> mbufs;
-	mbufs.resize(mbufs_count);
+		unsigned int mbufs_count = rte_mempool_avail_count(pool);
 
-	int rc = rte_mempool_ops_dequeue_bulk(mempool, (void**)&mbufs[0], mbufs_count);
-	if (rc)
-	{
-		YADECAP_LOG_ERROR("rte_mempool_ops_dequeue_bulk\n");
-		abort();
-	}
+		std::vector<rte_mbuf*> mbufs;
+		mbufs.resize(mbufs_count);
 
-	rc = rte_mempool_ops_enqueue_bulk(mempool, (void**)&mbufs[0], mbufs_count);
-	if (rc)
-	{
-		YADECAP_LOG_ERROR("rte_mempool_ops_enqueue_bulk\n");
-		abort();
-	}
+		int rc = rte_mempool_ops_dequeue_bulk(pool, (void**)&mbufs[0], mbufs_count);
+		if (rc)
+		{
+			YADECAP_LOG_ERROR("rte_mempool_ops_dequeue_bulk\n");
+			abort();
+		}
 
-	if (rte_mempool_default_cache(mempool, coreId))
-	{
-		YADECAP_LOG_ERROR("mempool cache not empty\n");
-		abort();
-	}
+		rc = rte_mempool_ops_enqueue_bulk(pool, (void**)&mbufs[0], mbufs_count);
+		if (rc)
+		{
+			YADECAP_LOG_ERROR("rte_mempool_ops_enqueue_bulk\n");
+			abort();
+		}
 
-	for (unsigned int mbuf_i = 0;
-	     mbuf_i < mbufs_count;
-	     mbuf_i++)
-	{
-		rte_mbuf* mbuf = mbufs[mbuf_i];
+		if (rte_mempool_default_cache(pool, coreId))
+		{
+			YADECAP_LOG_ERROR("mempool cache not empty\n");
+			abort();
+		}
+
+		for (unsigned int mbuf_i = 0;
+		     mbuf_i < mbufs_count;
+		     mbuf_i++)
+		{
+			rte_mbuf* mbuf = mbufs[mbuf_i];
 
-		rte_prefetch0((void*)mbuf);
-		rte_prefetch0((void*)YADECAP_METADATA(mbuf));
-		rte_prefetch0(rte_pktmbuf_mtod(mbuf, void*));
+			rte_prefetch0((void*)mbuf);
+			rte_prefetch0((void*)YADECAP_METADATA(mbuf));
+			rte_prefetch0(rte_pktmbuf_mtod(mbuf, void*));
+		}
 	}
 
 	rte_prefetch0((void*)&logicalPort_ingress_stack.mbufsCount);
@@ -302,6 +386,10 @@ void cWorker::FillMetadataWorkerCounters(common::sdp::MetadataWorker& metadata)
 	counters_stats["logs_packets"] = offsetof(common::worker::stats::common, logs_packets);
 	counters_stats["logs_drops"] = offsetof(common::worker::stats::common, logs_drops);
 	counters_stats["ttl_exceeded"] = offsetof(common::worker::stats::common, ttl_exceeded);
+	counters_stats["ttl_exceeded_limited"] = offsetof(common::worker::stats::common, ttl_exceeded_limited);
+	counters_stats["idle_iterations"] = offsetof(common::worker::stats::common, idle_iterations);
+	counters_stats["idle_sleep_us"] = offsetof(common::worker::stats::common, idle_sleep_us);
+	counters_stats["repeat_packets"] = offsetof(common::worker::stats::common, repeat_packets);
 	for (const auto& iter : counters_stats)
 	{
 		metadata.counter_positions[iter.first] = (metadata.start_stats + iter.second) / sizeof(uint64_t);
@@ -333,6 +421,13 @@ void cWorker::FillMetadataWorkerCounters(common::sdp::MetadataWorker& metadata)
 	counters_named["balancer_icmp_sent_to_real"] = common::globalBase::static_counter_type::balancer_icmp_sent_to_real;
 	counters_named["balancer_icmp_out_rate_limit_reached"] = common::globalBase::static_counter_type::balancer_icmp_out_rate_limit_reached;
 	counters_named["slow_worker_normal_priority_rate_limit_exceeded"] = common::globalBase::static_counter_type::slow_worker_normal_priority_rate_limit_exceeded;
+	counters_named["policer_local_class_drops"] = common::globalBase::static_counter_type::policer_local_class_drops;
+	counters_named["policer_local_source_drops"] = common::globalBase::static_counter_type::policer_local_source_drops;
+	counters_named["policer_kni_class_drops"] = common::globalBase::static_counter_type::policer_kni_class_drops;
+	counters_named["policer_kni_source_drops"] = common::globalBase::static_counter_type::policer_kni_source_drops;
+	counters_named["policer_slow_class_drops"] = common::globalBase::static_counter_type::policer_slow_class_drops;
+	counters_named["policer_slow_source_drops"] = common::globalBase::static_counter_type::policer_slow_source_drops;
+	counters_named["policer_evictions"] = common::globalBase::static_counter_type::policer_evictions;
 
 	counters_named["acl_ingress_v4_broken_packet"] = common::globalBase::static_counter_type::acl_ingress_v4_broken_packet;
 	counters_named["acl_ingress_v6_broken_packet"] = common::globalBase::static_counter_type::acl_ingress_v6_broken_packet;
@@ -374,28 +469,107 @@ eResult cWorker::sanityCheck()
 
 YANET_NEVER_INLINE void cWorker::mainThread()
 {
+	if (idle_backoff.enabled())
+	{
+		/// default 50us timer slack of nanosleep would exceed worker_idle_sleep_max_us
+		prctl(PR_SET_TIMERSLACK, 1UL, 0UL, 0UL, 0UL);
+	}
+
 	for (;;)
 	{
 		localBaseId = currentBaseId;
 
+		bool received = false;
+
 		/// @todo: opt
 		for (const auto& rx_point : basePermanently.rx_points)
 		{
 			toFreePackets_handle();
 			physicalPort_ingress_handle(rx_point);
 
-			if (unlikely(logicalPort_ingress_stack.mbufsCount == 0))
+			if (unlikely(logicalPort_ingress_stack.mbufsCount == 0 &&
+			             repeat_stack.mbufsCount == 0))
 			{
 				continue;
 			}
 
+			received = true;
 			handlePackets();
 		}
 
+		if (unlikely(!received))
+		{
+			idle_handle();
+		}
+		else
+		{
+			idle_backoff.busy();
+		}
+
 		iteration++;
 	}
 }
 
+YANET_NEVER_INLINE void cWorker::idle_handle()
+{
+	stats->idle_iterations++;
+
+	if (qos_enabled)
+	{
+		/// shaped packets are sent without new traffic
+		bool queued = false;
+		for (uint32_t port_i = 0;
+		     port_i < basePermanently.ports.size();
+		     port_i++)
+		{
+			queued |= !qos_schedulers[port_i].empty();
+		}
+
+		if (queued)
+		{
+			physicalPort_egress_handle();
+			idle_backoff.busy();
+			return;
+		}
+	}
+
+	const uint32_t sleep_us = idle_backoff.idle();
+	if (sleep_us == 0)
+	{
+		return;
+	}
+
+	if (sleep_us < dataplane::idle::spin_us_max)
+	{
+		/// short waits are shorter than syscall and wake-up of nanosleep
+		const uint64_t deadline = rte_get_tsc_cycles() + sleep_us * rte_get_tsc_hz() / 1000000;
+		while (rte_get_tsc_cycles() < deadline)
+		{
+			rte_pause();
+		}
+	}
+	else
+	{
+		rte_delay_us_sleep(sleep_us);
+	}
+
+	stats->idle_sleep_us += sleep_us;
+}
+
+inline rte_mbuf* cWorker::mbuf_alloc(uint32_t length)
+{
+	if (mempool_small && length <= mbuf_small_size)
+	{
+		rte_mbuf* mbuf = rte_pktmbuf_alloc(mempool_small);
+		if (mbuf)
+		{
+			return mbuf;
+		}
+	}
+
+	return rte_pktmbuf_alloc(mempool);
+}
+
 void cWorker::preparePacket(rte_mbuf* mbuf)
 {
 	dataplane::metadata* metadata = YADECAP_METADATA(mbuf);
@@ -458,7 +632,8 @@ inline void cWorker::translation_ipv4_to_ipv6(rte_mbuf* mbuf,
                                               const ipv6_address_t& ipv6_destination,
                                               const uint32_t port_source,
                                               const uint32_t port_destination,
-                                              const uint32_t identifier)
+                                              const uint32_t identifier,
+                                              const uint32_t ipv6_addresses_checksum)
 {
 	dataplane::metadata* metadata = YADECAP_METADATA(mbuf);
 
@@ -543,7 +718,15 @@ inline void cWorker::translation_ipv4_to_ipv6(rte_mbuf* mbuf,
 
 		payload_length = rte_be_to_cpu_16(ipv6_header->payload_len);
 
-		checksum_after = yanet_checksum(&ipv6_header->src_addr[0], 32);
+		if (ipv6_addresses_checksum != translation_ignore)
+		{
+			/// ipv4 addresses are embedded into last 32 bits of ipv6 addresses
+			checksum_after = csum_plus(checksum_before, ipv6_addresses_checksum);
+		}
+		else
+		{
+			checksum_after = yanet_checksum(&ipv6_header->src_addr[0], 32);
+		}
 	}
 
 	/// L4 layer translation
@@ -843,6 +1026,8 @@ inline void cWorker::handlePackets()
 		tsc_deltas->iter_num++;
 	}
 
+	repeat_handle();
+
 	auto stack_size = logicalPort_ingress_stack.mbufsCount;
 	logicalPort_ingress_handle();
 	tsc_deltas->write(tsc_start, stack_size, tsc_deltas->logicalPort_ingress_handle, base_values.logicalPort_ingress_handle);
@@ -988,10 +1173,11 @@ static_assert(CONFIG_YADECAP_LOGICALPORTS_SIZE == CONFIG_YADECAP_PORTS_SIZE * 81
 inline void cWorker::physicalPort_ingress_handle(const dpdk::Endpoint& rx_point)
 {
 	/// read packets from ports
+	/// recirculated packets of previous burst share stacks with received ones
 	uint16_t rxSize = rte_eth_rx_burst(rx_point.port,
 	                                   rx_point.queue,
 	                                   logicalPort_ingress_stack.mbufs,
-	                                   CONFIG_YADECAP_MBUFS_BURST_SIZE);
+	                                   CONFIG_YADECAP_MBUFS_BURST_SIZE - repeat_stack.mbufsCount);
 
 	/// init metadata
 	for (unsigned int mbuf_i = 0;
@@ -1027,7 +1213,7 @@ inline void cWorker::physicalPort_ingress_handle(const dpdk::Endpoint& rx_point)
 		{
 			if (!rte_ring_full(ring_lowPriority))
 			{
-				rte_mbuf* mbuf_clone = rte_pktmbuf_alloc(mempool);
+				rte_mbuf* mbuf_clone = mbuf_alloc(mbuf->data_len);
 				if (mbuf_clone)
 				{
 					*YADECAP_METADATA(mbuf_clone) = *YADECAP_METADATA(mbuf);
@@ -1062,6 +1248,13 @@ inline void cWorker::physicalPort_egress_handle()
 	     i++)
 	{
 		const auto portId = basePermanently.ports.ToDpdk(i);
+
+		if (unlikely(qos_schedulers[i].enabled()))
+		{
+			physicalPort_egress_qos_handle(i, portId);
+			continue;
+		}
+
 		if (unlikely(physicalPort_stack[i].mbufsCount == 0))
 		{
 			continue;
@@ -1085,6 +1278,56 @@ inline void cWorker::physicalPort_egress_handle()
 	}
 }
 
+inline void cWorker::physicalPort_egress_qos_handle(const tPortId logical_port_id,
+                                                    const tPortId port_id)
+{
+	auto& scheduler = qos_schedulers[logical_port_id];
+	auto& port_stack = physicalPort_stack[logical_port_id];
+
+	for (unsigned int mbuf_i = 0;
+	     mbuf_i < port_stack.mbufsCount;
+	     mbuf_i++)
+	{
+		if (!scheduler.enqueue(port_stack.mbufs[mbuf_i]))
+		{
+			/// class drops are counted by scheduler
+			stats->dropPackets++;
+			rte_pktmbuf_free(port_stack.mbufs[mbuf_i]);
+		}
+	}
+	port_stack.clear();
+
+	if (scheduler.empty())
+	{
+		return;
+	}
+
+	/// packets held back by the shaper stay in class queues until next iteration
+	port_stack.mbufsCount = scheduler.dequeue(port_stack.mbufs,
+	                                          CONFIG_YADECAP_MBUFS_BURST_SIZE,
+	                                          rte_get_tsc_cycles());
+	if (port_stack.mbufsCount == 0)
+	{
+		return;
+	}
+
+	uint16_t txSize = rte_eth_tx_burst(port_id,
+	                                   basePermanently.outQueueId,
+	                                   port_stack.mbufs,
+	                                   port_stack.mbufsCount);
+
+	statsPorts[logical_port_id].physicalPort_egress_drops += port_stack.mbufsCount - txSize;
+
+	for (;
+	     txSize < port_stack.mbufsCount;
+	     txSize++)
+	{
+		rte_pktmbuf_free(port_stack.mbufs[txSize]);
+	}
+
+	port_stack.clear();
+}
+
 inline void cWorker::logicalPort_ingress_handle()
 {
 	const auto& base = bases[localBaseId & 1];
@@ -1219,6 +1462,60 @@ inline void cWorker::logicalPort_ingress_flow(rte_mbuf* mbuf,
 	}
 }
 
+inline void cWorker::repeat_entry(rte_mbuf* mbuf)
+{
+	dataplane::metadata* metadata = YADECAP_METADATA(mbuf);
+
+	metadata->repeat_ttl--;
+	if (metadata->repeat_ttl == 0)
+	{
+		stats->repeat_ttl++;
+		rte_pktmbuf_free(mbuf);
+		return;
+	}
+
+	repeat_stack.insert(mbuf);
+}
+
+inline void cWorker::repeat_handle()
+{
+	const auto& base = bases[localBaseId & 1];
+
+	if (likely(repeat_stack.mbufsCount == 0))
+	{
+		return;
+	}
+
+	for (unsigned int mbuf_i = 0;
+	     mbuf_i < repeat_stack.mbufsCount;
+	     mbuf_i++)
+	{
+		rte_mbuf* mbuf = repeat_stack.mbufs[mbuf_i];
+		dataplane::metadata* metadata = YADECAP_METADATA(mbuf);
+
+		const rte_ether_hdr* ethernetHeader = rte_pktmbuf_mtod(mbuf, rte_ether_hdr*);
+		if (ethernetHeader->ether_type == rte_cpu_to_be_16(RTE_ETHER_TYPE_VLAN))
+		{
+			const rte_vlan_hdr* vlanHeader = rte_pktmbuf_mtod_offset(mbuf, rte_vlan_hdr*, sizeof(rte_ether_hdr));
+
+			metadata->flow.data.logicalPortId = CALCULATE_LOGICALPORT_ID(metadata->fromPortId, rte_be_to_cpu_16(vlanHeader->vlan_tci));
+		}
+		else
+		{
+			metadata->flow.data.logicalPortId = CALCULATE_LOGICALPORT_ID(metadata->fromPortId, 0);
+		}
+
+		preparePacket(mbuf);
+
+		const auto& logicalPort = base.globalBase->logicalPorts[metadata->flow.data.logicalPortId];
+
+		stats->repeat_packets++;
+		logicalPort_ingress_flow(mbuf, logicalPort.flow);
+	}
+
+	repeat_stack.clear();
+}
+
 inline void cWorker::logicalPort_egress_entry(rte_mbuf* mbuf)
 {
 	dataplane::metadata* metadata = YADECAP_METADATA(mbuf);
@@ -1294,7 +1591,7 @@ inline void cWorker::logicalPort_egress_handle()
 		{
 			if (!rte_ring_full(ring_lowPriority))
 			{
-				rte_mbuf* mbuf_clone = rte_pktmbuf_alloc(mempool);
+				rte_mbuf* mbuf_clone = mbuf_alloc(mbuf->data_len);
 				if (mbuf_clone)
 				{
 					*YADECAP_METADATA(mbuf_clone) = *YADECAP_METADATA(mbuf);
@@ -1369,60 +1666,33 @@ inline void cWorker::acl_ingress_entry(rte_mbuf* mbuf)
 using ActionsIngress = dataplane::ActionDispatcher<dataplane::FlowDirection::Ingress>;
 using ActionsEgress = dataplane::ActionDispatcher<dataplane::FlowDirection::Egress>;
 
-inline void cWorker::acl_ingress_handle4()
+inline void cWorker::acl_transport_keys(const dataplane::base::generation& base,
+                                        worker::tStack<>& stack,
+                                        uint32_t& mask)
 {
-	const auto& base = bases[localBaseId & 1];
 	const auto& acl = base.globalBase->acl;
 
-	if (unlikely(acl_ingress_stack4.mbufsCount == 0))
+	/// flat tables entries of packets, resolved after all entries are prefetched
+	struct
 	{
-		return;
-	}
-
-	uint32_t mask = 0xFFFFFFFFu >> (8 * sizeof(uint32_t) - acl_ingress_stack4.mbufsCount);
-
-	for (unsigned int mbuf_i = 0;
-	     mbuf_i < acl_ingress_stack4.mbufsCount;
-	     mbuf_i++)
-	{
-		rte_mbuf* mbuf = acl_ingress_stack4.mbufs[mbuf_i];
-		dataplane::metadata* metadata = YADECAP_METADATA(mbuf);
-
-		rte_ipv4_hdr* ipv4Header = rte_pktmbuf_mtod_offset(mbuf, rte_ipv4_hdr*, metadata->network_headerOffset);
-		key_acl.ipv4_sources[mbuf_i].address = ipv4Header->src_addr;
-		key_acl.ipv4_destinations[mbuf_i].address = ipv4Header->dst_addr;
-	}
-
-	acl.network.ipv4.source->lookup(key_acl.ipv4_sources,
-	                                value_acl.ipv4_sources,
-	                                acl_ingress_stack4.mbufsCount);
-
-	acl.network.ipv4.destination->lookup(key_acl.ipv4_destinations,
-	                                     value_acl.ipv4_destinations,
-	                                     acl_ingress_stack4.mbufsCount);
-
-	acl.network_table->lookup(value_acl.ipv4_sources,
-	                          value_acl.ipv4_destinations,
-	                          value_acl.networks,
-	                          acl_ingress_stack4.mbufsCount);
+		const uint16_t* group1;
+		const uint16_t* group2;
+		const uint8_t* group3;
+	} groups[CONFIG_YADECAP_MBUFS_BURST_SIZE];
 
 	for (unsigned int mbuf_i = 0;
-	     mbuf_i < acl_ingress_stack4.mbufsCount;
+	     mbuf_i < stack.mbufsCount;
 	     mbuf_i++)
 	{
-		rte_mbuf* mbuf = acl_ingress_stack4.mbufs[mbuf_i];
+		rte_mbuf* mbuf = stack.mbufs[mbuf_i];
 		dataplane::metadata* metadata = YADECAP_METADATA(mbuf);
 
-		const auto& network_value = value_acl.networks[mbuf_i];
-		auto& transport_key = key_acl.transports[mbuf_i];
-
-		const auto& transport_layer = acl.transport_layers[network_value & acl.transport_layers_mask];
+		const auto& transport_layer = acl.transport_layers[value_acl.networks[mbuf_i] & acl.transport_layers_mask];
+		auto& group = groups[mbuf_i];
 
-		transport_key.network_id = network_value;
-		transport_key.protocol = transport_layer.protocol.array[metadata->transport_headerType];
-		transport_key.group1 = 0;
-		transport_key.group2 = 0;
-		transport_key.group3 = 0;
+		group.group1 = nullptr;
+		group.group2 = nullptr;
+		group.group3 = nullptr;
 
 		if (!(metadata->network_flags & YANET_NETWORK_FLAG_NOT_FIRST_FRAGMENT))
 		{
@@ -1430,39 +1700,105 @@ inline void cWorker::acl_ingress_handle4()
 			{
 				rte_tcp_hdr* tcp_header = rte_pktmbuf_mtod_offset(mbuf, rte_tcp_hdr*, metadata->transport_headerOffset);
 
-				transport_key.group1 = transport_layer.tcp.source.array[rte_be_to_cpu_16(tcp_header->src_port)];
-				transport_key.group2 = transport_layer.tcp.destination.array[rte_be_to_cpu_16(tcp_header->dst_port)];
-				transport_key.group3 = transport_layer.tcp.flags.array[tcp_header->tcp_flags];
+				group.group1 = &transport_layer.tcp.source.array[rte_be_to_cpu_16(tcp_header->src_port)];
+				group.group2 = &transport_layer.tcp.destination.array[rte_be_to_cpu_16(tcp_header->dst_port)];
+				group.group3 = &transport_layer.tcp.flags.array[tcp_header->tcp_flags];
+				rte_prefetch0(group.group3);
 			}
 			else if (metadata->transport_headerType == IPPROTO_UDP)
 			{
 				rte_udp_hdr* udp_header = rte_pktmbuf_mtod_offset(mbuf, rte_udp_hdr*, metadata->transport_headerOffset);
 
-				transport_key.group1 = transport_layer.udp.source.array[rte_be_to_cpu_16(udp_header->src_port)];
-				transport_key.group2 = transport_layer.udp.destination.array[rte_be_to_cpu_16(udp_header->dst_port)];
+				group.group1 = &transport_layer.udp.source.array[rte_be_to_cpu_16(udp_header->src_port)];
+				group.group2 = &transport_layer.udp.destination.array[rte_be_to_cpu_16(udp_header->dst_port)];
 			}
 			else if (metadata->transport_headerType == IPPROTO_ICMP)
 			{
 				icmp_header_t* icmp_header = rte_pktmbuf_mtod_offset(mbuf, icmp_header_t*, metadata->transport_headerOffset);
 
-				transport_key.group1 = transport_layer.icmp.type_code.array[rte_be_to_cpu_16(icmp_header->typeCode)];
-				transport_key.group2 = transport_layer.icmp.identifier.array[rte_be_to_cpu_16(icmp_header->identifier)];
+				group.group1 = &transport_layer.icmp.type_code.array[rte_be_to_cpu_16(icmp_header->typeCode)];
+				group.group2 = &transport_layer.icmp.identifier.array[rte_be_to_cpu_16(icmp_header->identifier)];
 			}
 			else if (metadata->transport_headerType == IPPROTO_ICMPV6)
 			{
 				icmpv6_header_t* icmp_header = rte_pktmbuf_mtod_offset(mbuf, icmpv6_header_t*, metadata->transport_headerOffset);
 
-				transport_key.group1 = transport_layer.icmp.type_code.array[rte_be_to_cpu_16(icmp_header->typeCode)];
-				transport_key.group2 = transport_layer.icmp.identifier.array[rte_be_to_cpu_16(icmp_header->identifier)];
+				group.group1 = &transport_layer.icmp.type_code.array[rte_be_to_cpu_16(icmp_header->typeCode)];
+				group.group2 = &transport_layer.icmp.identifier.array[rte_be_to_cpu_16(icmp_header->identifier)];
 			}
 			else if (metadata->transport_headerType == YANET_TRANSPORT_TYPE_UNKNOWN)
 			{
 				mask ^= (1u << mbuf_i);
 			}
+
+			if (group.group1)
+			{
+				rte_prefetch0(group.group1);
+				rte_prefetch0(group.group2);
+			}
 		}
+	}
+
+	for (unsigned int mbuf_i = 0;
+	     mbuf_i < stack.mbufsCount;
+	     mbuf_i++)
+	{
+		rte_mbuf* mbuf = stack.mbufs[mbuf_i];
+		dataplane::metadata* metadata = YADECAP_METADATA(mbuf);
+
+		const auto& network_value = value_acl.networks[mbuf_i];
+		const auto& group = groups[mbuf_i];
+		auto& transport_key = key_acl.transports[mbuf_i];
 
+		const auto& transport_layer = acl.transport_layers[network_value & acl.transport_layers_mask];
+
+		transport_key.network_id = network_value;
+		transport_key.protocol = transport_layer.protocol.array[metadata->transport_headerType];
+		transport_key.group1 = group.group1 ? *group.group1 : 0;
+		transport_key.group2 = group.group2 ? *group.group2 : 0;
+		transport_key.group3 = group.group3 ? *group.group3 : 0;
 		transport_key.network_flags = acl.network_flags.array[metadata->network_flags];
 	}
+}
+
+inline void cWorker::acl_ingress_handle4()
+{
+	const auto& base = bases[localBaseId & 1];
+	const auto& acl = base.globalBase->acl;
+
+	if (unlikely(acl_ingress_stack4.mbufsCount == 0))
+	{
+		return;
+	}
+
+	uint32_t mask = 0xFFFFFFFFu >> (8 * sizeof(uint32_t) - acl_ingress_stack4.mbufsCount);
+
+	for (unsigned int mbuf_i = 0;
+	     mbuf_i < acl_ingress_stack4.mbufsCount;
+	     mbuf_i++)
+	{
+		rte_mbuf* mbuf = acl_ingress_stack4.mbufs[mbuf_i];
+		dataplane::metadata* metadata = YADECAP_METADATA(mbuf);
+
+		rte_ipv4_hdr* ipv4Header = rte_pktmbuf_mtod_offset(mbuf, rte_ipv4_hdr*, metadata->network_headerOffset);
+		key_acl.ipv4_sources[mbuf_i].address = ipv4Header->src_addr;
+		key_acl.ipv4_destinations[mbuf_i].address = ipv4Header->dst_addr;
+	}
+
+	acl.network.ipv4.source->lookup(key_acl.ipv4_sources,
+	                                value_acl.ipv4_sources,
+	                                acl_ingress_stack4.mbufsCount);
+
+	acl.network.ipv4.destination->lookup(key_acl.ipv4_destinations,
+	                                     value_acl.ipv4_destinations,
+	                                     acl_ingress_stack4.mbufsCount);
+
+	acl.network_table->lookup(value_acl.ipv4_sources,
+	                          value_acl.ipv4_destinations,
+	                          value_acl.networks,
+	                          acl_ingress_stack4.mbufsCount);
+
+	acl_transport_keys(base, acl_ingress_stack4, mask);
 
 	acl.transport_table->lookup(hashes,
 	                            key_acl.transports,
@@ -1560,64 +1896,8 @@ inline void cWorker::acl_ingress_handle6()
 	                          value_acl.networks,
 	                          acl_ingress_stack6.mbufsCount);
 
-	for (unsigned int mbuf_i = 0;
-	     mbuf_i < acl_ingress_stack6.mbufsCount;
-	     mbuf_i++)
-	{
-		rte_mbuf* mbuf = acl_ingress_stack6.mbufs[mbuf_i];
-		dataplane::metadata* metadata = YADECAP_METADATA(mbuf);
-
-		const auto& network_value = value_acl.networks[mbuf_i];
-		auto& transport_key = key_acl.transports[mbuf_i];
-
-		const auto& transport_layer = acl.transport_layers[network_value & acl.transport_layers_mask];
-
-		transport_key.network_id = network_value;
-		transport_key.protocol = transport_layer.protocol.array[metadata->transport_headerType];
-		transport_key.group1 = 0;
-		transport_key.group2 = 0;
-		transport_key.group3 = 0;
-
-		if (!(metadata->network_flags & YANET_NETWORK_FLAG_NOT_FIRST_FRAGMENT))
-		{
-			if (metadata->transport_headerType == IPPROTO_TCP)
-			{
-				rte_tcp_hdr* tcp_header = rte_pktmbuf_mtod_offset(mbuf, rte_tcp_hdr*, metadata->transport_headerOffset);
-
-				transport_key.group1 = transport_layer.tcp.source.array[rte_be_to_cpu_16(tcp_header->src_port)];
-				transport_key.group2 = transport_layer.tcp.destination.array[rte_be_to_cpu_16(tcp_header->dst_port)];
-				transport_key.group3 = transport_layer.tcp.flags.array[tcp_header->tcp_flags];
-			}
-			else if (metadata->transport_headerType == IPPROTO_UDP)
-			{
-				rte_udp_hdr* udp_header = rte_pktmbuf_mtod_offset(mbuf, rte_udp_hdr*, metadata->transport_headerOffset);
-
-				transport_key.group1 = transport_layer.udp.source.array[rte_be_to_cpu_16(udp_header->src_port)];
-				transport_key.group2 = transport_layer.udp.destination.array[rte_be_to_cpu_16(udp_header->dst_port)];
-			}
-			else if (metadata->transport_headerType == IPPROTO_ICMP)
-			{
-				icmp_header_t* icmp_header = rte_pktmbuf_mtod_offset(mbuf, icmp_header_t*, metadata->transport_headerOffset);
-
-				transport_key.group1 = transport_layer.icmp.type_code.array[rte_be_to_cpu_16(icmp_header->typeCode)];
-				transport_key.group2 = transport_layer.icmp.identifier.array[rte_be_to_cpu_16(icmp_header->identifier)];
-			}
-			else if (metadata->transport_headerType == IPPROTO_ICMPV6)
-			{
-				icmpv6_header_t* icmp_header = rte_pktmbuf_mtod_offset(mbuf, icmpv6_header_t*, metadata->transport_headerOffset);
-
-				transport_key.group1 = transport_layer.icmp.type_code.array[rte_be_to_cpu_16(icmp_header->typeCode)];
-				transport_key.group2 = transport_layer.icmp.identifier.array[rte_be_to_cpu_16(icmp_header->identifier)];
-			}
-			else if (metadata->transport_headerType == YANET_TRANSPORT_TYPE_UNKNOWN)
-			{
-				mask ^= (1u << mbuf_i);
-			}
-		}
-
-		transport_key.network_flags = acl.network_flags.array[metadata->network_flags];
-	}
-
+	acl_transport_keys(base, acl_ingress_stack6, mask);
+
 	acl.transport_table->lookup(hashes,
 	                            key_acl.transports,
 	                            value_acl.transports,
@@ -1678,20 +1958,27 @@ inline void cWorker::acl_ingress_flow(rte_mbuf* mbuf,
 
 	if (flow.type != common::globalBase::eFlowType::route_local && is_expired_ttl(mbuf))
 	{
-		rte_mbuf* new_mbuf = rte_pktmbuf_alloc(mempool);
-		yanet::icmp::CreatePackagePayload payload = yanet::icmp::CreateTimeExceededPackagePayload{
-		        .mbuf_source = mbuf,
-		        .host_config = bases[localBaseId & 1].globalBase->host_config};
-		if (yanet::icmp::create_icmp_package(yanet::icmp::TypePackage::TimeExceeded, new_mbuf, payload) == 0)
+		const auto& host_config = bases[localBaseId & 1].globalBase->host_config;
+
+		if (!time_exceeded_pass(mbuf, host_config))
+		{
+			stats->ttl_exceeded_limited++;
+			drop(mbuf);
+			return;
+		}
+
+		/// original packet is dropped, account it before rewrite reuses its mbuf
+		drop_account(mbuf);
+
+		if (yanet::icmp::rewrite_icmp_package_time_exceeded(mbuf, host_config) == 0)
 		{
-			route_entry(new_mbuf);
 			stats->ttl_exceeded++;
+			route_entry(mbuf);
 		}
 		else
 		{
-			rte_pktmbuf_free(new_mbuf);
+			rte_pktmbuf_free(mbuf);
 		}
-		drop(mbuf);
 		return;
 	}
 
@@ -2249,16 +2536,7 @@ inline void cWorker::route_handle4()
 		}
 		else if (route_value.type == common::globalBase::eNexthopType::repeat)
 		{
-			metadata->repeat_ttl--;
-			if (metadata->repeat_ttl == 0)
-			{
-				stats->repeat_ttl++;
-				rte_pktmbuf_free(mbuf);
-			}
-			else
-			{
-				slowWorker_entry_normalPriority(mbuf, common::globalBase::eFlowType::slowWorker_repeat);
-			}
+			repeat_entry(mbuf);
 			continue;
 		}
 		else
@@ -2384,16 +2662,7 @@ inline void cWorker::route_handle6()
 		}
 		else if (route_value.type == common::globalBase::eNexthopType::repeat)
 		{
-			metadata->repeat_ttl--;
-			if (metadata->repeat_ttl == 0)
-			{
-				stats->repeat_ttl++;
-				rte_pktmbuf_free(mbuf);
-			}
-			else
-			{
-				slowWorker_entry_normalPriority(mbuf, common::globalBase::eFlowType::slowWorker_repeat);
-			}
+			repeat_entry(mbuf);
 			continue;
 		}
 		else
@@ -2628,16 +2897,7 @@ inline void cWorker::route_tunnel_handle4()
 		}
 		else if (route_value.type == common::globalBase::eNexthopType::repeat)
 		{
-			metadata->repeat_ttl--;
-			if (metadata->repeat_ttl == 0)
-			{
-				stats->repeat_ttl++;
-				rte_pktmbuf_free(mbuf);
-			}
-			else
-			{
-				slowWorker_entry_normalPriority(mbuf, common::globalBase::eFlowType::slowWorker_repeat);
-			}
+			repeat_entry(mbuf);
 			continue;
 		}
 		else
@@ -2766,16 +3026,7 @@ inline void cWorker::route_tunnel_handle6()
 		}
 		else if (route_value.type == common::globalBase::eNexthopType::repeat)
 		{
-			metadata->repeat_ttl--;
-			if (metadata->repeat_ttl == 0)
-			{
-				stats->repeat_ttl++;
-				rte_pktmbuf_free(mbuf);
-			}
-			else
-			{
-				slowWorker_entry_normalPriority(mbuf, common::globalBase::eFlowType::slowWorker_repeat);
-			}
+			repeat_entry(mbuf);
 			continue;
 		}
 		else
@@ -3451,13 +3702,54 @@ inline void cWorker::nat64stateful_wan_flow(rte_mbuf* mbuf,
 	}
 }
 
+/// Resolves translation of flow matched by acl rule of 1:1 translations, false if not found
+inline bool cWorker::nat64stateless_ingress_lookup(rte_mbuf* mbuf)
+{
+	dataplane::metadata* metadata = YADECAP_METADATA(mbuf);
+	if (likely(metadata->flow.data.nat64stateless.translationId != common::globalBase::nat64stateless_translation_lookup))
+	{
+		return true;
+	}
+
+	const auto& base = bases[localBaseId & 1];
+	const rte_ipv6_hdr* ipv6Header = rte_pktmbuf_mtod_offset(mbuf, rte_ipv6_hdr*, metadata->network_headerOffset);
+
+	uint32_t hashes[1];
+	dataplane::globalBase::nat64stateless_ingress_key_t keys[1];
+	uint32_t values[1];
+
+	rte_memcpy(keys[0].ipv6Address.bytes, ipv6Header->src_addr, 16);
+	rte_memcpy(keys[0].ipv6DestinationPrefix, ipv6Header->dst_addr, sizeof(keys[0].ipv6DestinationPrefix));
+	keys[0].nat64stateless_id = metadata->flow.data.nat64stateless.id;
+
+	if (!base.globalBase->nat64stateless_ingress_lookup->lookup(hashes, keys, values, 1))
+	{
+		return false;
+	}
+
+	metadata->flow.data.nat64stateless.translationId = values[0];
+	return true;
+}
+
 inline void cWorker::nat64stateless_ingress_entry_checked(rte_mbuf* mbuf)
 {
+	if (!nat64stateless_ingress_lookup(mbuf))
+	{
+		drop(mbuf);
+		return;
+	}
+
 	nat64stateless_ingress_stack.insert(mbuf);
 }
 
 inline void cWorker::nat64stateless_ingress_entry_icmp(rte_mbuf* mbuf)
 {
+	if (!nat64stateless_ingress_lookup(mbuf))
+	{
+		drop(mbuf);
+		return;
+	}
+
 	slowWorker_entry_normalPriority(mbuf, common::globalBase::eFlowType::slowWorker_nat64stateless_ingress_icmp);
 }
 
@@ -3465,6 +3757,12 @@ inline void cWorker::nat64stateless_ingress_entry_fragmentation(rte_mbuf* mbuf)
 {
 	dataplane::metadata* metadata = YADECAP_METADATA(mbuf);
 
+	if (!nat64stateless_ingress_lookup(mbuf))
+	{
+		drop(mbuf);
+		return;
+	}
+
 	if (metadata->transport_headerType == IPPROTO_ICMPV6)
 	{
 		// icmp checksum use payload length which is calculated from first and last fragments
@@ -3576,18 +3874,64 @@ inline void cWorker::nat64stateless_ingress_translation(rte_mbuf* mbuf,
 	mark_ipv4_dscp(mbuf, nat64stateless.ipv4DSCPFlags);
 }
 
+/// Resolves translation of flow matched by acl rule of 1:1 translations, false if not found
+inline bool cWorker::nat64stateless_egress_lookup(rte_mbuf* mbuf)
+{
+	dataplane::metadata* metadata = YADECAP_METADATA(mbuf);
+	if (likely(metadata->flow.data.nat64stateless.translationId != common::globalBase::nat64stateless_translation_lookup))
+	{
+		return true;
+	}
+
+	const auto& base = bases[localBaseId & 1];
+	const rte_ipv4_hdr* ipv4Header = rte_pktmbuf_mtod_offset(mbuf, rte_ipv4_hdr*, metadata->network_headerOffset);
+
+	uint32_t hashes[1];
+	dataplane::globalBase::nat64stateless_egress_key_t keys[1];
+	uint32_t values[1];
+
+	keys[0].ipv4Address.address = ipv4Header->dst_addr;
+	keys[0].nat64stateless_id = metadata->flow.data.nat64stateless.id;
+
+	if (!base.globalBase->nat64stateless_egress_lookup->lookup(hashes, keys, values, 1))
+	{
+		return false;
+	}
+
+	metadata->flow.data.nat64stateless.translationId = values[0];
+	return true;
+}
+
 inline void cWorker::nat64stateless_egress_entry_checked(rte_mbuf* mbuf)
 {
+	if (!nat64stateless_egress_lookup(mbuf))
+	{
+		drop(mbuf);
+		return;
+	}
+
 	nat64stateless_egress_stack.insert(mbuf);
 }
 
 inline void cWorker::nat64stateless_egress_entry_icmp(rte_mbuf* mbuf)
 {
+	if (!nat64stateless_egress_lookup(mbuf))
+	{
+		drop(mbuf);
+		return;
+	}
+
 	slowWorker_entry_normalPriority(mbuf, common::globalBase::eFlowType::slowWorker_nat64stateless_egress_icmp);
 }
 
 inline void cWorker::nat64stateless_egress_entry_fragmentation(rte_mbuf* mbuf)
 {
+	if (!nat64stateless_egress_lookup(mbuf))
+	{
+		drop(mbuf);
+		return;
+	}
+
 	slowWorker_entry_normalPriority(mbuf, common::globalBase::eFlowType::slowWorker_nat64stateless_egress_fragmentation);
 }
 
@@ -3786,20 +4130,19 @@ inline void cWorker::nat46clat_lan_translation(rte_mbuf* mbuf,
 	dataplane::metadata* metadata = YADECAP_METADATA(mbuf);
 	rte_ipv4_hdr* ipv4_header = rte_pktmbuf_mtod_offset(mbuf, rte_ipv4_hdr*, metadata->network_headerOffset);
 
-	ipv6_address_t ipv6_source;
-	rte_memcpy(&ipv6_source.bytes[0], nat46clat.ipv6_source.bytes, 12);
-	rte_memcpy(&ipv6_source.bytes[12], &ipv4_header->src_addr, 4);
+	ipv6_address_t ipv6_source = nat46clat.ipv6_source;
+	ipv6_source.mapped_ipv4_address.address = ipv4_header->src_addr;
 
-	ipv6_address_t ipv6_destination;
-	rte_memcpy(&ipv6_destination.bytes[0], nat46clat.ipv6_destination.bytes, 12);
-	rte_memcpy(&ipv6_destination.bytes[12], &ipv4_header->dst_addr, 4);
+	ipv6_address_t ipv6_destination = nat46clat.ipv6_destination;
+	ipv6_destination.mapped_ipv4_address.address = ipv4_header->dst_addr;
 
 	translation_ipv4_to_ipv6(mbuf,
 	                         ipv6_source,
 	                         ipv6_destination,
 	                         translation_ignore,
 	                         translation_ignore,
-	                         translation_ignore);
+	                         translation_ignore,
+	                         nat46clat.ipv6_prefixes_checksum);
 }
 
 inline void cWorker::nat46clat_lan_flow(rte_mbuf* mbuf,
@@ -5155,7 +5498,9 @@ inline void cWorker::acl_create_state(rte_mbuf* mbuf, tAclId aclId, const common
 
 inline void cWorker::acl_state_emit(tAclId aclId, const dataplane::globalBase::fw_state_sync_frame_t& frame)
 {
-	rte_mbuf* mbuf = rte_pktmbuf_alloc(mempool);
+	constexpr uint16_t payload_offset = sizeof(rte_ether_hdr) + sizeof(rte_vlan_hdr) + sizeof(rte_ipv6_hdr) + sizeof(rte_udp_hdr);
+
+	rte_mbuf* mbuf = mbuf_alloc(payload_offset + sizeof(dataplane::globalBase::fw_state_sync_frame_t));
 	if (mbuf == nullptr)
 	{
 		stats->fwsync_multicast_egress_drops++;
@@ -5164,7 +5509,6 @@ inline void cWorker::acl_state_emit(tAclId aclId, const dataplane::globalBase::f
 
 	/// @todo: init metadata
 
-	constexpr uint16_t payload_offset = sizeof(rte_ether_hdr) + sizeof(rte_vlan_hdr) + sizeof(rte_ipv6_hdr) + sizeof(rte_udp_hdr);
 	rte_pktmbuf_append(mbuf, payload_offset + sizeof(dataplane::globalBase::fw_state_sync_frame_t));
 
 	dataplane::metadata* metadata = YADECAP_METADATA(mbuf);
@@ -5237,63 +5581,7 @@ inline void cWorker::acl_egress_handle4()
 	                          value_acl.networks,
 	                          acl_egress_stack4.mbufsCount);
 
-	for (unsigned int mbuf_i = 0;
-	     mbuf_i < acl_egress_stack4.mbufsCount;
-	     mbuf_i++)
-	{
-		rte_mbuf* mbuf = acl_egress_stack4.mbufs[mbuf_i];
-		dataplane::metadata* metadata = YADECAP_METADATA(mbuf);
-
-		const auto& network_value = value_acl.networks[mbuf_i];
-		auto& transport_key = key_acl.transports[mbuf_i];
-
-		const auto& transport_layer = acl.transport_layers[network_value & acl.transport_layers_mask];
-
-		transport_key.network_id = network_value;
-		transport_key.protocol = transport_layer.protocol.array[metadata->transport_headerType];
-		transport_key.group1 = 0;
-		transport_key.group2 = 0;
-		transport_key.group3 = 0;
-
-		if (!(metadata->network_flags & YANET_NETWORK_FLAG_NOT_FIRST_FRAGMENT))
-		{
-			if (metadata->transport_headerType == IPPROTO_TCP)
-			{
-				rte_tcp_hdr* tcp_header = rte_pktmbuf_mtod_offset(mbuf, rte_tcp_hdr*, metadata->transport_headerOffset);
-
-				transport_key.group1 = transport_layer.tcp.source.array[rte_be_to_cpu_16(tcp_header->src_port)];
-				transport_key.group2 = transport_layer.tcp.destination.array[rte_be_to_cpu_16(tcp_header->dst_port)];
-				transport_key.group3 = transport_layer.tcp.flags.array[tcp_header->tcp_flags];
-			}
-			else if (metadata->transport_headerType == IPPROTO_UDP)
-			{
-				rte_udp_hdr* udp_header = rte_pktmbuf_mtod_offset(mbuf, rte_udp_hdr*, metadata->transport_headerOffset);
-
-				transport_key.group1 = transport_layer.udp.source.array[rte_be_to_cpu_16(udp_header->src_port)];
-				transport_key.group2 = transport_layer.udp.destination.array[rte_be_to_cpu_16(udp_header->dst_port)];
-			}
-			else if (metadata->transport_headerType == IPPROTO_ICMP)
-			{
-				icmp_header_t* icmp_header = rte_pktmbuf_mtod_offset(mbuf, icmp_header_t*, metadata->transport_headerOffset);
-
-				transport_key.group1 = transport_layer.icmp.type_code.array[rte_be_to_cpu_16(icmp_header->typeCode)];
-				transport_key.group2 = transport_layer.icmp.identifier.array[rte_be_to_cpu_16(icmp_header->identifier)];
-			}
-			else if (metadata->transport_headerType == IPPROTO_ICMPV6)
-			{
-				icmpv6_header_t* icmp_header = rte_pktmbuf_mtod_offset(mbuf, icmpv6_header_t*, metadata->transport_headerOffset);
-
-				transport_key.group1 = transport_layer.icmp.type_code.array[rte_be_to_cpu_16(icmp_header->typeCode)];
-				transport_key.group2 = transport_layer.icmp.identifier.array[rte_be_to_cpu_16(icmp_header->identifier)];
-			}
-			else if (metadata->transport_headerType == YANET_TRANSPORT_TYPE_UNKNOWN)
-			{
-				mask ^= (1u << mbuf_i);
-			}
-		}
-
-		transport_key.network_flags = acl.network_flags.array[metadata->network_flags];
-	}
+	acl_transport_keys(base, acl_egress_stack4, mask);
 
 	acl.transport_table->lookup(hashes,
 	                            key_acl.transports,
@@ -5384,63 +5672,7 @@ inline void cWorker::acl_egress_handle6()
 	                          value_acl.networks,
 	                          acl_egress_stack6.mbufsCount);
 
-	for (unsigned int mbuf_i = 0;
-	     mbuf_i < acl_egress_stack6.mbufsCount;
-	     mbuf_i++)
-	{
-		rte_mbuf* mbuf = acl_egress_stack6.mbufs[mbuf_i];
-		dataplane::metadata* metadata = YADECAP_METADATA(mbuf);
-
-		const auto& network_value = value_acl.networks[mbuf_i];
-		auto& transport_key = key_acl.transports[mbuf_i];
-
-		const auto& transport_layer = acl.transport_layers[network_value & acl.transport_layers_mask];
-
-		transport_key.network_id = network_value;
-		transport_key.protocol = transport_layer.protocol.array[metadata->transport_headerType];
-		transport_key.group1 = 0;
-		transport_key.group2 = 0;
-		transport_key.group3 = 0;
-
-		if (!(metadata->network_flags & YANET_NETWORK_FLAG_NOT_FIRST_FRAGMENT))
-		{
-			if (metadata->transport_headerType == IPPROTO_TCP)
-			{
-				rte_tcp_hdr* tcp_header = rte_pktmbuf_mtod_offset(mbuf, rte_tcp_hdr*, metadata->transport_headerOffset);
-
-				transport_key.group1 = transport_layer.tcp.source.array[rte_be_to_cpu_16(tcp_header->src_port)];
-				transport_key.group2 = transport_layer.tcp.destination.array[rte_be_to_cpu_16(tcp_header->dst_port)];
-				transport_key.group3 = transport_layer.tcp.flags.array[tcp_header->tcp_flags];
-			}
-			else if (metadata->transport_headerType == IPPROTO_UDP)
-			{
-				rte_udp_hdr* udp_header = rte_pktmbuf_mtod_offset(mbuf, rte_udp_hdr*, metadata->transport_headerOffset);
-
-				transport_key.group1 = transport_layer.udp.source.array[rte_be_to_cpu_16(udp_header->src_port)];
-				transport_key.group2 = transport_layer.udp.destination.array[rte_be_to_cpu_16(udp_header->dst_port)];
-			}
-			else if (metadata->transport_headerType == IPPROTO_ICMP)
-			{
-				icmp_header_t* icmp_header = rte_pktmbuf_mtod_offset(mbuf, icmp_header_t*, metadata->transport_headerOffset);
-
-				transport_key.group1 = transport_layer.icmp.type_code.array[rte_be_to_cpu_16(icmp_header->typeCode)];
-				transport_key.group2 = transport_layer.icmp.identifier.array[rte_be_to_cpu_16(icmp_header->identifier)];
-			}
-			else if (metadata->transport_headerType == IPPROTO_ICMPV6)
-			{
-				icmpv6_header_t* icmp_header = rte_pktmbuf_mtod_offset(mbuf, icmpv6_header_t*, metadata->transport_headerOffset);
-
-				transport_key.group1 = transport_layer.icmp.type_code.array[rte_be_to_cpu_16(icmp_header->typeCode)];
-				transport_key.group2 = transport_layer.icmp.identifier.array[rte_be_to_cpu_16(icmp_header->identifier)];
-			}
-			else if (metadata->transport_headerType == YANET_TRANSPORT_TYPE_UNKNOWN)
-			{
-				mask ^= (1u << mbuf_i);
-			}
-		}
-
-		transport_key.network_flags = acl.network_flags.array[metadata->network_flags];
-	}
+	acl_transport_keys(base, acl_egress_stack6, mask);
 
 	acl.transport_table->lookup(hashes,
 	                            key_acl.transports,
@@ -5741,6 +5973,11 @@ inline void cWorker::dregress_entry(rte_mbuf* mbuf)
 
 inline void cWorker::controlPlane(rte_mbuf* mbuf)
 {
+	if (!policer_pass(mbuf, dataplane::policer::class_e::kni))
+	{
+		return;
+	}
+
 	dataplane::metadata* metadata = YADECAP_METADATA(mbuf);
 	metadata->flow.type = common::globalBase::eFlowType::slowWorker_kni;
 
@@ -5772,7 +6009,63 @@ inline void cWorker::controlPlane_handle()
 	controlPlane_stack.clear();
 }
 
+static_assert((uint32_t)common::globalBase::static_counter_type::policer_slow_source_drops ==
+              (uint32_t)common::globalBase::static_counter_type::policer_local_class_drops + 2 * (uint32_t)dataplane::policer::class_e::slow + 1,
+              "policer counters are placed as pairs (class_drops, source_drops) per class");
+
+inline bool cWorker::policer_pass(rte_mbuf* mbuf,
+                                  const dataplane::policer::class_e class_id)
+{
+	if (likely(!policer.enabled()))
+	{
+		return true;
+	}
+
+	dataplane::metadata* metadata = YADECAP_METADATA(mbuf);
+
+	dataplane::policer::source_t source;
+	if (metadata->network_headerType == rte_cpu_to_be_16(RTE_ETHER_TYPE_IPV4))
+	{
+		rte_ipv4_hdr* ipv4Header = rte_pktmbuf_mtod_offset(mbuf, rte_ipv4_hdr*, metadata->network_headerOffset);
+		source = policer.source_ipv4(ipv4Header->src_addr);
+	}
+	else if (metadata->network_headerType == rte_cpu_to_be_16(RTE_ETHER_TYPE_IPV6))
+	{
+		rte_ipv6_hdr* ipv6Header = rte_pktmbuf_mtod_offset(mbuf, rte_ipv6_hdr*, metadata->network_headerOffset);
+		source = policer.source_ipv6(ipv6Header->src_addr);
+	}
+	else
+	{
+		generic_rte_ether_hdr* ethernetHeader = rte_pktmbuf_mtod(mbuf, generic_rte_ether_hdr*);
+		source = policer.source_ether(ethernetHeader->src_addr.addr_bytes);
+	}
+
+	auto result = policer.check(class_id, source, rte_get_tsc_cycles());
+	counters[(uint32_t)common::globalBase::static_counter_type::policer_evictions] = policer.get_evictions();
+
+	if (likely(result == dataplane::policer::policer_t::result_e::pass))
+	{
+		return true;
+	}
+
+	uint32_t counter_id = (uint32_t)common::globalBase::static_counter_type::policer_local_class_drops + 2 * (uint32_t)class_id;
+	if (result == dataplane::policer::policer_t::result_e::source_drop)
+	{
+		counter_id++;
+	}
+	counters[counter_id]++;
+
+	rte_pktmbuf_free(mbuf);
+	return false;
+}
+
 inline void cWorker::drop(rte_mbuf* mbuf)
+{
+	drop_account(mbuf);
+	rte_pktmbuf_free(mbuf);
+}
+
+inline void cWorker::drop_account(rte_mbuf* mbuf)
 {
 	stats->dropPackets++;
 	dataplane::metadata* metadata = YADECAP_METADATA(mbuf);
@@ -5781,7 +6074,7 @@ inline void cWorker::drop(rte_mbuf* mbuf)
 	{
 		if (!rte_ring_full(ring_lowPriority))
 		{
-			rte_mbuf* mbuf_clone = rte_pktmbuf_alloc(mempool);
+			rte_mbuf* mbuf_clone = mbuf_alloc(mbuf->data_len);
 			if (mbuf_clone)
 			{
 				*YADECAP_METADATA(mbuf_clone) = *YADECAP_METADATA(mbuf);
@@ -5800,8 +6093,6 @@ inline void cWorker::drop(rte_mbuf* mbuf)
 			}
 		}
 	}
-
-	rte_pktmbuf_free(mbuf);
 }
 
 inline void cWorker::toFreePackets_handle()
@@ -5824,6 +6115,11 @@ inline void cWorker::slowWorker_entry_highPriority(rte_mbuf* mbuf,
 {
 	/// @todo: worker::tStack
 
+	if (!policer_pass(mbuf, dataplane::policer::class_e::local))
+	{
+		return;
+	}
+
 	dataplane::metadata* metadata = YADECAP_METADATA(mbuf);
 	metadata->flow.type = flowType;
 
@@ -5843,6 +6139,12 @@ inline void cWorker::slowWorker_entry_normalPriority(rte_mbuf* mbuf,
 {
 	/// @todo: worker::tStack
 
+	/// policer goes first: packets it drops must not consume the shared budget
+	if (!policer_pass(mbuf, dataplane::policer::class_e::slow))
+	{
+		return;
+	}
+
 	if (basePermanently.SWNormalPriorityRateLimitPerWorker != 0 && __atomic_fetch_sub(&packetsToSWNPRemainder, 1, __ATOMIC_RELAXED) <= 0)
 	{
 		rte_pktmbuf_free(mbuf);
@@ -5888,6 +6190,13 @@ YANET_NEVER_INLINE void cWorker::slowWorkerBeforeHandlePackets()
 YANET_NEVER_INLINE void cWorker::slowWorkerHandlePackets()
 {
 	handlePackets();
+
+	/// slow worker has no next burst, recirculate packets of repeat nexthops until done
+	while (repeat_stack.mbufsCount)
+	{
+		handlePackets();
+	}
+
 	toFreePackets_handle();
 }
 
@@ -6080,6 +6389,34 @@ inline void cWorker::populate_hitcount_map(const std::string& id, rte_mbuf* mbuf
 	entry.bytes += mbuf->pkt_len;
 }
 
+inline bool cWorker::time_exceeded_pass(rte_mbuf* mbuf, const dataplane::globalBase::host_config_t& host_config)
+{
+	const auto& rate = host_config.time_exceeded_rate;
+	if (likely(rate.rate == 0))
+	{
+		return true;
+	}
+
+	dataplane::metadata* metadata = YADECAP_METADATA(mbuf);
+
+	if (metadata->network_headerType == rte_cpu_to_be_16(RTE_ETHER_TYPE_IPV4))
+	{
+		const rte_ipv4_hdr* ip_header = rte_pktmbuf_mtod_offset(mbuf, rte_ipv4_hdr*, metadata->network_headerOffset);
+		return icmp_limiter.consume_ipv4(rate,
+		                                 host_config.time_exceeded_ipv4_prefix,
+		                                 ip_header->src_addr,
+		                                 rte_get_tsc_hz(),
+		                                 rte_get_tsc_cycles());
+	}
+
+	const rte_ipv6_hdr* ip_header = rte_pktmbuf_mtod_offset(mbuf, rte_ipv6_hdr*, metadata->network_headerOffset);
+	return icmp_limiter.consume_ipv6(rate,
+	                                 host_config.time_exceeded_ipv6_prefix,
+	                                 ip_header->src_addr,
+	                                 rte_get_tsc_hz(),
+	                                 rte_get_tsc_cycles());
+}
+
 inline bool cWorker::is_expired_ttl(rte_mbuf* mbuf)
 {
 	auto metadata = YADECAP_METADATA(mbuf);
@@ -17,6 +17,9 @@
 #include "common.h"
 #include "dump_rings.h"
 #include "globalbase.h"
+#include "idle.h"
+#include "policer.h"
+#include "qos.h"
 #include "rte_branch_prediction.h"
 #include "samples.h"
 
@@ -90,7 +93,8 @@ public:
 
 protected:
 	constexpr static uint32_t translation_ignore = 0xFFFFFFFFu;
-	inline void translation_ipv4_to_ipv6(rte_mbuf* mbuf, const ipv6_address_t& ipv6_source, const ipv6_address_t& ipv6_destination, const uint32_t port_source, const uint32_t port_destination, const uint32_t identifier);
+	/// ipv6_addresses_checksum: checksum of ipv6 addresses without embedded ipv4 addresses, if known
+	inline void translation_ipv4_to_ipv6(rte_mbuf* mbuf, const ipv6_address_t& ipv6_source, const ipv6_address_t& ipv6_destination, const uint32_t port_source, const uint32_t port_destination, const uint32_t identifier, const uint32_t ipv6_addresses_checksum = translation_ignore);
 	inline void translation_ipv6_to_ipv4(rte_mbuf* mbuf, const ipv4_address_t& ipv4_source, const ipv4_address_t& ipv4_destination, const uint32_t port_source, const uint32_t port_destination, const uint32_t identifier);
 
 	inline void mark_ipv4_dscp(rte_mbuf* mbuf, const uint8_t dscp_flags);
@@ -101,10 +105,19 @@ protected:
 	inline void physicalPort_ingress_handle(const dpdk::Endpoint& rx_point);
 
 	inline void physicalPort_egress_handle();
+	inline void physicalPort_egress_qos_handle(const tPortId logical_port_id, const tPortId port_id);
+	YANET_NEVER_INLINE void idle_handle();
+
+	/// allocates mbuf for packet of length bytes, from small mempool if it fits
+	inline rte_mbuf* mbuf_alloc(uint32_t length);
 
 	inline void logicalPort_ingress_handle();
 	inline void logicalPort_ingress_flow(rte_mbuf* mbuf, const common::globalBase::tFlow& flow);
 
+	/// packets of repeat nexthops are fed back to logical port flow on next burst
+	inline void repeat_entry(rte_mbuf* mbuf);
+	inline void repeat_handle();
+
 	inline void logicalPort_egress_entry(rte_mbuf* mbuf);
 	inline void logicalPort_egress_handle();
 
@@ -112,6 +125,8 @@ protected:
 	inline void after_early_decap_entry(rte_mbuf* mbuf);
 
 	inline void acl_ingress_entry(rte_mbuf* mbuf);
+	/// fills transport keys of packets with network values, flat tables entries are prefetched for whole burst
+	inline void acl_transport_keys(const dataplane::base::generation& base, worker::tStack<>& stack, uint32_t& mask);
 	inline void acl_ingress_handle4();
 	inline void acl_ingress_handle6();
 	inline void acl_ingress_flow(rte_mbuf* mbuf, const common::globalBase::tFlow& flow);
@@ -151,6 +166,7 @@ protected:
 	inline void nat64stateful_wan_flow(rte_mbuf* mbuf, const common::globalBase::tFlow& flow);
 
 	/// nat64stateless lan (ipv6)
+	inline bool nat64stateless_ingress_lookup(rte_mbuf* mbuf);
 	inline void nat64stateless_ingress_entry_checked(rte_mbuf* mbuf);
 	inline void nat64stateless_ingress_entry_icmp(rte_mbuf* mbuf);
 	inline void nat64stateless_ingress_entry_fragmentation(rte_mbuf* mbuf);
@@ -159,6 +175,7 @@ protected:
 	inline void nat64stateless_ingress_translation(rte_mbuf* mbuf, const dataplane::globalBase::tNat64stateless& nat64stateless, const dataplane::globalBase::nat64stateless_translation_t& translation);
 
 	/// nat64stateless wan (ipv4)
+	inline bool nat64stateless_egress_lookup(rte_mbuf* mbuf);
 	inline void nat64stateless_egress_entry_checked(rte_mbuf* mbuf);
 	inline void nat64stateless_egress_entry_icmp(rte_mbuf* mbuf);
 	inline void nat64stateless_egress_entry_fragmentation(rte_mbuf* mbuf);
@@ -214,7 +231,11 @@ protected:
 	inline void controlPlane(rte_mbuf* mbuf);
 	inline void controlPlane_handle();
 
+	inline bool policer_pass(rte_mbuf* mbuf, const dataplane::policer::class_e class_id);
+
 	inline void drop(rte_mbuf* mbuf);
+	/// counts and dumps dropped packet, mbuf stays owned by caller
+	inline void drop_account(rte_mbuf* mbuf);
 
 	inline void toFreePackets_handle();
 
@@ -227,6 +248,8 @@ protected:
 
 	inline void populate_hitcount_map(const std::string& id, rte_mbuf* mbuf);
 	inline bool is_expired_ttl(rte_mbuf* mbuf);
+	/// rate limit of generated icmp time exceeded, per source prefix of packet
+	inline bool time_exceeded_pass(rte_mbuf* mbuf, const dataplane::globalBase::host_config_t& host_config);
 
 protected:
 	/// @todo: move to slow_worker_t
@@ -297,6 +320,8 @@ public:
 	tSocketId socketId;
 
 	rte_mempool* mempool;
+	rte_mempool* mempool_small; ///< nullptr if worker_mbuf_small_size is zero
+	uint32_t mbuf_small_size;
 
 protected:
 	/// variables above are not needed for mainThread()
@@ -361,6 +386,7 @@ protected:
 	worker::tStack<> physicalPort_stack[CONFIG_YADECAP_PORTS_SIZE];
 	worker::tStack<> logicalPort_ingress_stack;
 	worker::tStack<> logicalPort_egress_stack;
+	worker::tStack<> repeat_stack;
 	worker::tStack<> acl_ingress_stack4;
 	worker::tStack<> acl_ingress_stack6;
 	worker::tStack<> tun64_stack4;
@@ -411,6 +437,21 @@ protected:
 	// will decrease with each new packet sent to slow worker, replenishes each N mseconds
 	int32_t packetsToSWNPRemainder;
 
+	// per source token buckets for packets punted to slow worker and linux
+	dataplane::policer::policer_t policer;
+
+	// token buckets of acl rate-limit meters, rates are in globalbase
+	dataplane::policer::meter_t acl_meters[YANET_CONFIG_ACL_METERS_SIZE];
+
+	// token buckets of generated icmp time exceeded, rate is in host_config
+	dataplane::policer::icmp_limiter_t icmp_limiter;
+
+	// egress schedulers, enabled only for ports with qos config
+	dataplane::qos::scheduler_t qos_schedulers[CONFIG_YADECAP_PORTS_SIZE];
+	bool qos_enabled{};
+
+	dataplane::idle::backoff_t idle_backoff;
+
 	using DumpRingBasePtr = std::unique_ptr<dumprings::RingBase>;
 	std::array<DumpRingBasePtr, YANET_CONFIG_SHARED_RINGS_NUMBER> dump_rings;
 
@@ -1055,12 +1055,12 @@ void worker_gc_t::handle_samples()
 	}
 }
 
-void worker_gc_t::nat64stateful_state(const common::idp::nat64stateful_state::request& request,
-                                      common::idp::nat64stateful_state::response& response)
+void worker_gc_t::nat64stateful_state(const std::optional<uint32_t>& filter_nat64stateful_id,
+                                      uint32_t& offset,
+                                      const uint32_t limit,
+                                      common::idp::nat64stateful_state::states& response)
 {
-	uint32_t offset = 0;
 	run_on_this_thread([&]() {
-		const auto& [filter_nat64stateful_id] = request;
 		auto& globalbase_atomic = base_permanently.globalBaseAtomic;
 
 		for (auto iter : globalbase_atomic->updater.nat64stateful_wan_state.range(offset, 64))
@@ -1171,7 +1171,8 @@ void worker_gc_t::nat64stateful_state(const common::idp::nat64stateful_state::re
 			                      std::move(wan_last_seen_opt));
 		}
 
-		if (offset != 0)
+		if (offset != 0 &&
+		    response.size() < limit)
 		{
 			return false;
 		}
@@ -28,7 +28,8 @@ public:
 	void start();
 
 	void run_on_this_thread(const std::function<bool()>& callback);
-	void nat64stateful_state(const common::idp::nat64stateful_state::request& request, common::idp::nat64stateful_state::response& response);
+	/// appends states starting from offset until there are limit of them, leaves offset 0 when the table is done
+	void nat64stateful_state(const std::optional<uint32_t>& filter_nat64stateful_id, uint32_t& offset, const uint32_t limit, common::idp::nat64stateful_state::states& response);
 	void balancer_state_clear();
 
 	void limits(common::idp::limits::response& response) const;
@@ -1151,6 +1151,7 @@ bool fw_config_t::validate_rule(rule_ptr_t rulep)
 		case rule_action_t::CHECKSTATE:
 		case rule_action_t::STATETIMEOUT:
 		case rule_action_t::HITCOUNT:
+		case rule_action_t::RATELIMIT:
 			break;
 		default:
 			return true;
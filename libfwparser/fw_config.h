@@ -172,6 +172,7 @@ enum class rule_action_t
 	DUMP,
 	STATETIMEOUT,
 	HITCOUNT,
+	RATELIMIT,
 };
 
 enum class rule_action_modifier_t
@@ -295,9 +296,11 @@ struct rule_t
 	                                 uint16_t>;
 	using address_t = std::set<ip_prefix_mask_t>; // addr, addr/len, addr/mask
 	using sockaddr_t = std::tuple<common::ip_address_t, uint16_t>; // addr, port
+	using ratelimit_arg_t = std::tuple<std::string, int64_t, int64_t>; // meter, rate (pps), burst
 	using action_arg_t = std::variant<std::string,
 	                                  sockaddr_t,
-	                                  int64_t>;
+	                                  int64_t,
+	                                  ratelimit_arg_t>;
 	using opcode_arg_t = std::variant<common::range_t,
 	                                  uint32_t>;
 
@@ -131,7 +131,7 @@
 		SRCPRJID DSTPRJID RED ALL LMAX DSTIP6 SRCIP6 TCPSETMSS
 		NAT64CLAT NAT64LSN NAT64STL NPTV6 SRCADDR QM DSTADDR
 		SRCPORT DSTPORT SRCIP DSTIP EQUAL COMMA MINUS EOL M4LQ M4RQ DUMP
-		STATETIMEOUT HITCOUNT
+		STATETIMEOUT HITCOUNT RATELIMIT
 
 // QUEUE could be an argument to *MASK
 %precedence	QUEUE
@@ -518,6 +518,20 @@ action:
 		cfg.set_rule_action_arg($2);
 	}
 	|
+	RATELIMIT TOKEN NUMBER NUMBER
+	{
+		if ($3 < 1 || $3 > UINT32_MAX)  {
+			std::cerr << "ratelimit rate must be in range 1.." << UINT32_MAX << std::endl;
+			YYERROR;
+		}
+		if ($4 < 1 || $4 > UINT32_MAX)  {
+			std::cerr << "ratelimit burst must be in range 1.." << UINT32_MAX << std::endl;
+			YYERROR;
+		}
+		cfg.set_rule_action(rule_action_t::RATELIMIT);
+		cfg.set_rule_action_arg(rule_t::ratelimit_arg_t($2, $3, $4));
+	}
+	|
 	T_REJECT
 	{
 		cfg.set_rule_action(rule_action_t::UNREACH);